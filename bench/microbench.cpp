@@ -0,0 +1,770 @@
+#include "microbench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "hypercube_objects.h"
+#include "cross_section.h"
+#include "edge_strips.h"
+#include "face_lattice.h"
+#include "filled_faces.h"
+#include "polytope_cache.h"
+#include "polytope_generators.h"
+#include "polytope_operators.h"
+#include "projection.h"
+#include "quickhull.h"
+#include "radix_sort.h"
+#include "streamed_hypercube.h"
+#include "wythoff.h"
+#include "zonotope.h"
+
+// Keeps results observable so the optimizer can't delete the kernels
+static volatile float sink;
+
+// Correctness checks that failed while the kernels were set up; any of them fails the run
+static int mismatches = 0;
+
+static const int SAMPLE_COUNT = 15;
+static const double MIN_SAMPLE_MS = 2.0;
+static const double DEFAULT_THRESHOLD = 0.25;
+
+struct KernelStats {
+    double medianNs;
+    double meanNs;
+    double stddevNs;
+};
+
+static double timeIterations(const MicroKernel& kernel, long long iterations) {
+    auto start = std::chrono::steady_clock::now();
+    kernel.body(iterations);
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static KernelStats measure(const MicroKernel& kernel) {
+    // grow the batch until one sample is long enough to be above timer noise
+    long long iterations = 1;
+    while (timeIterations(kernel, iterations) < MIN_SAMPLE_MS * 1.0e6 && iterations < (1LL << 40)) {
+        iterations *= 2;
+    }
+
+    double samples[SAMPLE_COUNT];
+    for (int i = 0; i < SAMPLE_COUNT; i++) {
+        samples[i] = timeIterations(kernel, iterations) / iterations;
+    }
+
+    KernelStats stats;
+    double sum = 0.0;
+    for (double s : samples) {
+        sum += s;
+    }
+    stats.meanNs = sum / SAMPLE_COUNT;
+    double variance = 0.0;
+    for (double s : samples) {
+        variance += (s - stats.meanNs) * (s - stats.meanNs);
+    }
+    stats.stddevNs = std::sqrt(variance / (SAMPLE_COUNT - 1));
+    std::sort(samples, samples + SAMPLE_COUNT);
+    stats.medianNs = samples[SAMPLE_COUNT / 2];
+    return stats;
+}
+
+static const char* familyName(int family) {
+    static const char* const names[] = { "hypercube", "simplex", "cross", "24-cell", "120-cell", "600-cell", "4_21", "point-hull", "duoprism", "zonotope" };
+    return family >= 0 && family < 10 ? names[family] : "unknown";
+}
+
+// Rotation planes (0,1), (2,3), ... as used by the kernels below
+static void makeDisjointPlanes(int dims, int count, std::vector<RotationPlane>& planes) {
+    planes.clear();
+    for (int p = 0; p < count; p++) {
+        RotationPlane plane = { (2 * p) % dims, (2 * p + 1) % dims, 0.3f + 0.1f * p };
+        planes.push_back(plane);
+    }
+}
+
+void addMathKernels(std::vector<MicroKernel>& kernels) {
+    // buildRotationMatrix at every dimension and plane count
+    for (int dims = 2; dims <= 8; dims++) {
+        for (int planeCount = 1; planeCount <= dims / 2; planeCount++) {
+            struct RotationSetup {
+                std::vector<RotationPlane> planes;
+                std::vector<float> identity;
+                NDimObjectData object;
+            };
+            std::shared_ptr<RotationSetup> setup(new RotationSetup());
+            makeDisjointPlanes(dims, planeCount, setup->planes);
+            setup->identity.resize(dims * dims);
+            setup->object = NDimObjectData();
+            setup->object.dimensions = dims;
+            setup->object.defaultRotationPlanes = setup->planes.data();
+            setup->object.numRotationPlanes = planeCount;
+            setup->object.identityMatrix = setup->identity.data();
+            setup->object.initIdentityMatrix();
+
+            char name[64];
+            snprintf(name, sizeof(name), "rotation/%dD/%dp", dims, planeCount);
+            MicroKernel kernel;
+            kernel.name = name;
+            kernel.itemsPerOp = 0.0;
+            kernel.bytesPerOp = dims * dims * sizeof(float);
+            kernel.body = [setup](long long iterations) {
+                float matrix[64];
+                for (long long i = 0; i < iterations; i++) {
+                    setup->object.buildRotationMatrix(matrix, (float)i * 0.001f);
+                    sink = matrix[0];
+                }
+            };
+            kernels.push_back(kernel);
+        }
+    }
+
+    // N-D projection chain over each hypercube's vertex list (hot: fits in L1)
+    ObjectMap objects;
+    populateObjectMap(objects);
+    for (int dims = 2; dims <= 8; dims++) {
+        NDimObjectData* cube = objects[std::make_pair(0, dims)];
+        cube->initIdentityMatrix();
+        std::shared_ptr<std::vector<float>> world(new std::vector<float>((size_t)cube->vertexCount * 3));
+
+        char name[64];
+        snprintf(name, sizeof(name), "projection/%dD/hot", dims);
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = cube->vertexCount;
+        kernel.bytesPerOp = (double)cube->vertexCount * (dims + 3) * sizeof(float);
+        kernel.body = [cube, world](long long iterations) {
+            float rotation[64];
+            for (long long i = 0; i < iterations; i++) {
+                cube->buildRotationMatrix(rotation, (float)i * 0.001f);
+                transformVertices(rotation, cube->dimensions, cube->scale, cube->vertices, cube->vertexCount, world->data());
+                sink = (*world)[0];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+
+    // Same chain over a 32 MB stream of 8D vertices, so throughput reflects memory bandwidth
+    {
+        const int dims = 8;
+        const int streamVertices = 1 << 20;
+        NDimObjectData* cube = objects[std::make_pair(0, dims)];
+        std::shared_ptr<std::vector<float>> input(new std::vector<float>((size_t)streamVertices * dims));
+        for (size_t i = 0; i < input->size(); i++) {
+            (*input)[i] = cube->vertices[i % ((size_t)cube->vertexCount * dims)];
+        }
+        std::shared_ptr<std::vector<float>> world(new std::vector<float>((size_t)streamVertices * 3));
+
+        MicroKernel kernel;
+        kernel.name = "projection/8D/stream";
+        kernel.itemsPerOp = streamVertices;
+        kernel.bytesPerOp = (double)streamVertices * (dims + 3) * sizeof(float);
+        kernel.body = [cube, input, world, streamVertices](long long iterations) {
+            float rotation[64];
+            for (long long i = 0; i < iterations; i++) {
+                cube->buildRotationMatrix(rotation, (float)i * 0.001f);
+                transformVertices(rotation, 8, cube->scale, input->data(), streamVertices, world->data());
+                sink = (*world)[0];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+
+    // Covering the edge list with line strips, as setupBuffers does
+    for (auto& entry : objects) {
+        NDimObjectData* object = entry.second;
+        if (object->dimensions != 8) {
+            continue;
+        }
+        std::shared_ptr<std::vector<unsigned int>> indices(new std::vector<unsigned int>());
+
+        char name[64];
+        snprintf(name, sizeof(name), "strips/%s/8D", familyName(entry.first.first));
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = object->edgeCount;
+        kernel.bytesPerOp = object->edgeCount * 2 * sizeof(unsigned int);
+        kernel.body = [object, indices](long long iterations) {
+            for (long long i = 0; i < iterations; i++) {
+                buildLineStrips(object->vertexCount, object->edges, object->edgeCount, *indices);
+                sink = (float)indices->size();
+            }
+        };
+        kernels.push_back(kernel);
+    }
+
+    // Cross-sections of the 8-cube: the mid-section of every n-cube is an (n-1)-cube
+    {
+        for (int dims = 3; dims <= 8; dims++) {
+            NDimObjectData* cube = objects[std::make_pair(0, dims)];
+            loadLattice(*cube);
+            CrossSection section;
+            section.setObject(*cube);
+            section.update(cube->identityMatrix, 0.0f);
+            if (section.vertexCount() != 1 << (dims - 1) || section.edgeCount() != (dims - 1) << (dims - 2)) {
+                std::cout << "ERROR::CROSS_SECTION::MISMATCH hypercube " << dims << "D" << std::endl;
+                mismatches++;
+            }
+        }
+
+        // alternating between two rotations rebuilds the topology every time; a fixed rotation reuses it
+        NDimObjectData* cube = objects[std::make_pair(0, 8)];
+        for (int rebuild = 1; rebuild >= 0; rebuild--) {
+            std::shared_ptr<CrossSection> section(new CrossSection());
+            section->setObject(*cube);
+
+            MicroKernel kernel;
+            kernel.name = rebuild ? "slice/hypercube/8D/rebuild" : "slice/hypercube/8D/reuse";
+            kernel.itemsPerOp = cube->vertexCount;
+            kernel.bytesPerOp = (double)cube->vertexCount * 8 * sizeof(float);
+            kernel.body = [cube, section, rebuild](long long iterations) {
+                float rotation[2][64];
+                cube->buildRotationMatrix(rotation[0], 1.0f);
+                cube->buildRotationMatrix(rotation[1], 10.0f);
+                float offset = 0.3f * section->circumradius();
+                for (long long i = 0; i < iterations; i++) {
+                    section->update(rotation[rebuild ? i & 1 : 0], offset);
+                    sink = section->vertices().empty() ? 0.0f : section->vertices()[0];
+                }
+            };
+            kernels.push_back(kernel);
+        }
+    }
+
+    // Radix sort against std::stable_sort, on the face count of the 8-cube and on enough keys to go parallel
+    for (int count : { 1792, 1 << 20 }) {
+        std::shared_ptr<std::vector<uint32_t>> input(new std::vector<uint32_t>(count));
+        srand(count);
+        for (uint32_t& key : *input) {
+            key = floatSortKey((float)(rand() - RAND_MAX / 2) / RAND_MAX);
+        }
+        std::vector<uint32_t> keys = *input;
+        std::vector<uint32_t> values(count);
+        for (int i = 0; i < count; i++) {
+            values[i] = (uint32_t)i;
+        }
+        std::vector<uint32_t> expected = values;
+        std::stable_sort(expected.begin(), expected.end(), [&input](uint32_t a, uint32_t b) { return (*input)[a] < (*input)[b]; });
+        RadixSortScratch scratch;
+        radixSortPairs(keys, values, scratch);
+        if (values != expected) {
+            std::cout << "ERROR::RADIX_SORT::MISMATCH " << count << " keys" << std::endl;
+            mismatches++;
+        }
+
+        char name[64];
+        snprintf(name, sizeof(name), "sort/radix/%d", count);
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = count;
+        kernel.bytesPerOp = (double)count * 2 * sizeof(uint32_t);
+        kernel.body = [input, count](long long iterations) {
+            std::vector<uint32_t> keys;
+            std::vector<uint32_t> values(count);
+            RadixSortScratch scratch;
+            for (long long i = 0; i < iterations; i++) {
+                keys = *input;
+                radixSortPairs(keys, values, scratch);
+                sink = (float)keys[0];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+
+    // Depth sorting the 8-cube's 1792 squares for a moving rotation, as the face mode does every frame
+    {
+        NDimObjectData* cube = objects[std::make_pair(0, 8)];
+        loadLattice(*cube);
+        std::shared_ptr<FilledFaces> faces(new FilledFaces());
+        faces->setObject(*cube);
+        glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 1.0f, -4.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        faces->update(cube->identityMatrix, cube->scale, view);
+        if (faces->faceCount() != 1792 || faces->triangleCount() != 2 * 1792
+            || !std::is_sorted(faces->depthKeys().begin(), faces->depthKeys().end())) {
+            std::cout << "ERROR::FILLED_FACES::MISMATCH hypercube 8D" << std::endl;
+            mismatches++;
+        }
+
+        MicroKernel kernel;
+        kernel.name = "faces/hypercube/8D/sort";
+        kernel.itemsPerOp = faces->faceCount();
+        kernel.bytesPerOp = 0.0;
+        kernel.body = [cube, faces, view](long long iterations) {
+            float rotation[64];
+            for (long long i = 0; i < iterations; i++) {
+                cube->buildRotationMatrix(rotation, (float)i * 0.001f);
+                faces->update(rotation, cube->scale, view);
+                sink = (float)faces->order()[0];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+
+    // Family generators, and mapping + validating their cache files
+    static void (*const generators[])(int, PolytopeMesh&) = { generateHypercube, generateSimplex, generateCrossPolytope };
+    for (int family = 0; family < 3; family++) {
+        const int dims = 8;
+        char name[64];
+        snprintf(name, sizeof(name), "generate/%s/%dD", familyName(family), dims);
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = 0.0;
+        kernel.bytesPerOp = 0.0;
+        kernel.body = [family, dims](long long iterations) {
+            PolytopeMesh mesh;
+            for (long long i = 0; i < iterations; i++) {
+                generators[family](dims, mesh);
+                sink = mesh.vertices[0];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+    // Face lattice from facet incidence, on every core
+    for (int family = 0; family < 3; family++) {
+        const int dims = 8;
+        std::shared_ptr<PolytopeMesh> mesh(new PolytopeMesh());
+        generators[family](dims, *mesh);
+        FaceLattice lattice;
+        buildFaceLattice(*mesh, lattice);
+
+        char name[64];
+        snprintf(name, sizeof(name), "lattice/%s/%dD", familyName(family), dims);
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = lattice.totalFaces();
+        kernel.bytesPerOp = 0.0;
+        kernel.body = [mesh](long long iterations) {
+            FaceLattice lattice;
+            for (long long i = 0; i < iterations; i++) {
+                buildFaceLattice(*mesh, lattice);
+                sink = (float)lattice.totalFaces();
+            }
+        };
+        kernels.push_back(kernel);
+    }
+    // Polar dual from the lattice; hypercube and cross-polytope must come out as each other
+    struct LatticeSetup {
+        PolytopeMesh mesh;
+        FaceLattice lattice;
+    };
+    for (int family = 0; family < 3; family += 2) {
+        const int dims = 8;
+        std::shared_ptr<LatticeSetup> setup(new LatticeSetup());
+        generators[family](dims, setup->mesh);
+        buildFaceLattice(setup->mesh, setup->lattice);
+        for (int n = 2; n <= dims; n++) {
+            PolytopeMesh primal;
+            PolytopeMesh expected;
+            PolytopeMesh dual;
+            FaceLattice lattice;
+            generators[family](n, primal);
+            generators[2 - family](n, expected);
+            if (!buildFaceLattice(primal, lattice) || !dualPolytope(primal.vertices.data(), n, lattice, dual)
+                || !samePolytope(dual, expected, 1e-5f)) {
+                std::cout << "ERROR::DUAL::MISMATCH " << familyName(family) << " " << n << "D" << std::endl;
+                mismatches++;
+            }
+        }
+
+        char name[64];
+        snprintf(name, sizeof(name), "dual/%s/%dD", familyName(family), dims);
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = setup->lattice.totalFaces();
+        kernel.bytesPerOp = 0.0;
+        kernel.body = [setup, dims](long long iterations) {
+            PolytopeMesh dual;
+            for (long long i = 0; i < iterations; i++) {
+                dualPolytope(setup->mesh.vertices.data(), dims, setup->lattice, dual);
+                sink = dual.vertices[0];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+    // Ring operators on the 8-cube; on a regular polytope every result is uniform
+    {
+        const int dims = 8;
+        std::shared_ptr<LatticeSetup> setup(new LatticeSetup());
+        generateHypercube(dims, setup->mesh);
+        buildFaceLattice(setup->mesh, setup->lattice);
+        for (int op = 0; op < OPERATOR_COUNT; op++) {
+            PolytopeMesh result;
+            applyPolytopeOperator((PolytopeOperator)op, setup->mesh.vertices.data(), dims, setup->lattice, result);
+            float shortest = 1e30f;
+            float longest = 0.0f;
+            for (int e = 0; e < result.edgeCount(); e++) {
+                const float* a = &result.vertices[result.edges[2 * e] * dims];
+                const float* b = &result.vertices[result.edges[2 * e + 1] * dims];
+                float length = 0.0f;
+                for (int i = 0; i < dims; i++) {
+                    length += (a[i] - b[i]) * (a[i] - b[i]);
+                }
+                shortest = std::min(shortest, length);
+                longest = std::max(longest, length);
+            }
+            if (result.edgeCount() == 0 || longest > shortest * (1.0f + 1e-4f)) {
+                std::cout << "ERROR::RINGED_POLYTOPE::NOT_UNIFORM " << polytopeOperatorName((PolytopeOperator)op) << std::endl;
+                mismatches++;
+            }
+
+            char name[64];
+            snprintf(name, sizeof(name), "operator/%s/hypercube/%dD", polytopeOperatorName((PolytopeOperator)op), dims);
+            MicroKernel kernel;
+            kernel.name = name;
+            kernel.itemsPerOp = result.vertexCount();
+            kernel.bytesPerOp = 0.0;
+            kernel.body = [setup, dims, op](long long iterations) {
+                PolytopeMesh mesh;
+                for (long long i = 0; i < iterations; i++) {
+                    applyPolytopeOperator((PolytopeOperator)op, setup->mesh.vertices.data(), dims, setup->lattice, mesh);
+                    sink = mesh.vertices[0];
+                }
+            };
+            kernels.push_back(kernel);
+        }
+    }
+    // Wythoff orbit enumeration
+    {
+        struct WythoffCase {
+            const char* name;
+            const char* diagram;
+            const char* rings;
+        };
+        static const WythoffCase cases[] = {
+            { "wythoff/120-cell", "5 3 3", "xooo" },
+            { "wythoff/4_21", "E8", "xooooooo" },
+            { "wythoff/omnitruncated-120-cell", "5 3 3", "xxxx" }
+        };
+        for (const WythoffCase& c : cases) {
+            std::shared_ptr<CoxeterDiagram> diagram(new CoxeterDiagram());
+            parseCoxeterDiagram(c.diagram, *diagram);
+            PolytopeMesh mesh;
+            generateWythoff(*diagram, c.rings, mesh);
+
+            MicroKernel kernel;
+            kernel.name = c.name;
+            kernel.itemsPerOp = mesh.vertexCount();
+            kernel.bytesPerOp = 0.0;
+            std::string rings = c.rings;
+            kernel.body = [diagram, rings](long long iterations) {
+                PolytopeMesh mesh;
+                for (long long i = 0; i < iterations; i++) {
+                    generateWythoff(*diagram, rings, mesh);
+                    sink = mesh.vertices[0];
+                }
+            };
+            kernels.push_back(kernel);
+        }
+    }
+    // Cartesian product of two 50-gons: 2500 vertices, 5000 edges, 100 facets
+    {
+        std::shared_ptr<PolytopeMesh> polygon(new PolytopeMesh());
+        generatePolygon(50, *polygon);
+
+        MicroKernel kernel;
+        kernel.name = "product/duoprism/50x50";
+        kernel.itemsPerOp = 50 * 50;
+        kernel.bytesPerOp = 0.0;
+        kernel.body = [polygon](long long iterations) {
+            PolytopeMesh mesh;
+            for (long long i = 0; i < iterations; i++) {
+                productPolytope(*polygon, *polygon, mesh);
+                sink = (float)mesh.edgeCount();
+            }
+        };
+        kernels.push_back(kernel);
+    }
+    // Zonotopes of cyclic generators: the interactive sizes the Zonotope object's slider covers
+    {
+        struct ZonotopeCase {
+            int dims;
+            int generators;
+        };
+        static const ZonotopeCase cases[] = { { 3, 48 }, { 4, 36 }, { 5, 24 }, { 8, 12 } };
+        for (const ZonotopeCase& c : cases) {
+            std::shared_ptr<std::vector<float>> generators(new std::vector<float>());
+            generateCyclicGenerators(c.generators, c.dims, *generators);
+            PolytopeMesh mesh;
+            generateZonotope(generators->data(), c.generators, c.dims, mesh);
+
+            char name[64];
+            snprintf(name, sizeof(name), "zonotope/cyclic/%dD/%d", c.dims, c.generators);
+            MicroKernel kernel;
+            kernel.name = name;
+            kernel.itemsPerOp = mesh.vertexCount();
+            kernel.bytesPerOp = 0.0;
+            int dims = c.dims;
+            int count = c.generators;
+            kernel.body = [generators, dims, count](long long iterations) {
+                PolytopeMesh mesh;
+                for (long long i = 0; i < iterations; i++) {
+                    generateZonotope(generators->data(), count, dims, mesh);
+                    sink = mesh.vertices[0];
+                }
+            };
+            kernels.push_back(kernel);
+        }
+    }
+    // Quickhull of random points on S^(N-1), sized so each hull takes tens of milliseconds
+    {
+        static const int hullPoints[] = { 2000, 1000, 400, 200, 100, 60 };
+        for (int dims = 3; dims <= 8; dims++) {
+            int count = hullPoints[dims - 3];
+            std::shared_ptr<std::vector<float>> points(new std::vector<float>());
+            generateSpherePoints(dims, count, 1, *points);
+
+            char name[64];
+            snprintf(name, sizeof(name), "hull/sphere/%dD/%d", dims, count);
+            MicroKernel kernel;
+            kernel.name = name;
+            kernel.itemsPerOp = count;
+            kernel.bytesPerOp = 0.0;
+            kernel.body = [points, count, dims](long long iterations) {
+                PolytopeMesh mesh;
+                for (long long i = 0; i < iterations; i++) {
+                    computeConvexHull(points->data(), count, dims, mesh);
+                    sink = (float)mesh.facetCount();
+                }
+            };
+            kernels.push_back(kernel);
+        }
+    }
+    {
+        // the first call generates cache/microbench-hypercube_8D_*.ndpc, every later one maps it
+        const int dims = 8;
+        auto generate = [dims](PolytopeMesh& mesh) { generateHypercube(dims, mesh); };
+        std::unique_ptr<PolytopeCacheFile> file = loadOrGeneratePolytope("microbench-hypercube", dims, "", generate);
+
+        MicroKernel kernel;
+        kernel.name = "cache/load/hypercube/8D";
+        kernel.itemsPerOp = file->vertexCount();
+        kernel.bytesPerOp = (double)(file->vertexBytes() + file->edgeCount() * 2 * sizeof(unsigned int));
+        kernel.body = [generate, dims](long long iterations) {
+            for (long long i = 0; i < iterations; i++) {
+                std::unique_ptr<PolytopeCacheFile> mapped = loadOrGeneratePolytope("microbench-hypercube", dims, "", generate);
+                sink = mapped->vertices()[0];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+
+    // One chunk of the streamed huge-N hypercube (bit-flip enumeration + projection)
+    for (int dims = 12; dims <= STREAM_MAX_DIMENSIONS; dims += 4) {
+        struct StreamSetup {
+            HypercubeStreamFrame frame;
+            std::vector<float> out;
+        };
+        std::shared_ptr<StreamSetup> setup(new StreamSetup());
+        std::vector<float> rotation((size_t)dims * dims);
+        generateIdentityMatrix(rotation.data(), dims);
+        prepareStreamFrame(setup->frame, dims, rotation.data(), 1.0f);
+        setup->out.resize((size_t)STREAM_CHUNK_EDGES * 6);
+        int perChunk = streamVerticesPerChunk(dims);
+
+        char name[64];
+        snprintf(name, sizeof(name), "stream/%dD/chunk", dims);
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = perChunk * dims / 2.0;      // edges, on average half the bits are clear
+        kernel.bytesPerOp = kernel.itemsPerOp * 6 * sizeof(float);
+        kernel.body = [setup, perChunk](long long iterations) {
+            for (long long i = 0; i < iterations; i++) {
+                int edges = generateHypercubeChunk(setup->frame, (i % 64) * perChunk, perChunk, setup->out.data());
+                sink = setup->out[(size_t)edges * 6 - 1];
+            }
+        };
+        kernels.push_back(kernel);
+    }
+}
+
+void addBufferKernels(std::vector<MicroKernel>& kernels) {
+    // Full VAO/VBO setup for each registered object, as NDimObjectData::init does it.
+    // glFinish() makes the driver copy part of the measured time.
+    ObjectMap objects;
+    populateObjectMap(objects);
+    for (auto& entry : objects) {
+        NDimObjectData* object = entry.second;
+        int dims = object->dimensions;
+
+        char name[64];
+        snprintf(name, sizeof(name), "buffer/%s/%dD", familyName(entry.first.first), dims);
+        MicroKernel kernel;
+        kernel.name = name;
+        kernel.itemsPerOp = object->vertexCount;
+        kernel.bytesPerOp = object->vertexDataSize;
+        kernel.body = [object, dims](long long iterations) {
+            for (long long i = 0; i < iterations; i++) {
+                unsigned int VAO, VBO;
+                glGenVertexArrays(1, &VAO);
+                glGenBuffers(1, &VBO);
+                glBindVertexArray(VAO);
+                glBindBuffer(GL_ARRAY_BUFFER, VBO);
+                glBufferData(GL_ARRAY_BUFFER, object->vertexDataSize, object->vertices, GL_STATIC_DRAW);
+                setupVertexAttributes(dims, VERTEX_FORMAT_FLOAT32);
+                glFinish();
+                glDeleteVertexArrays(1, &VAO);
+                glDeleteBuffers(1, &VBO);
+            }
+        };
+        kernels.push_back(kernel);
+    }
+}
+
+// Hidden 1x1 window, only so buffer kernels have a context
+static GLFWwindow* createMicroContext() {
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(1, 1, "ndbench micro", NULL, NULL);
+    if (window == NULL) {
+        std::cout << "Failed to create GLFW window" << std::endl;
+        glfwTerminate();
+        return nullptr;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cout << "Failed to initialize GLAD" << std::endl;
+        glfwTerminate();
+        return nullptr;
+    }
+    return window;
+}
+
+static std::map<std::string, double> loadBaseline(const std::string& path) {
+    std::map<std::string, double> baseline;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        size_t comma = line.find(',');
+        if (comma == std::string::npos || line.compare(0, comma, "kernel") == 0) {
+            continue;
+        }
+        baseline[line.substr(0, comma)] = atof(line.c_str() + comma + 1);
+    }
+    return baseline;
+}
+
+int runMicrobenchmarks(int argc, char** argv) {
+    std::string filter;
+    std::string baselinePath = "bench/micro_baseline.csv";
+    std::string writeBaselinePath;
+    double threshold = DEFAULT_THRESHOLD;
+    bool failOnRegression = false;
+    bool gpu = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        }
+        else if (arg == "--baseline" && hasValue) {
+            baselinePath = argv[++i];
+        }
+        else if (arg == "--threshold" && hasValue) {
+            threshold = atof(argv[++i]);
+        }
+        else if (arg == "--write-baseline" && hasValue) {
+            writeBaselinePath = argv[++i];
+        }
+        else if (arg == "--fail-on-regression") {
+            failOnRegression = true;
+        }
+        else if (arg == "--gpu") {
+            gpu = true;
+        }
+        else {
+            std::cout << "usage: ndbench micro [--gpu] [--filter substring] [--baseline path] [--threshold 0.25] [--fail-on-regression] [--write-baseline path]" << std::endl;
+            return -1;
+        }
+    }
+
+    std::vector<MicroKernel> kernels;
+    addMathKernels(kernels);
+    GLFWwindow* window = nullptr;
+    if (gpu) {
+        window = createMicroContext();
+        if (window == nullptr) {
+            return -1;
+        }
+        addBufferKernels(kernels);
+    }
+
+    std::map<std::string, double> baseline = loadBaseline(baselinePath);
+    std::ostringstream newBaseline;
+    newBaseline << "# ndbench micro baseline: median ns/op per kernel; regenerate with --write-baseline on the reference machine\n";
+    newBaseline << "kernel,ns_per_op\n";
+
+    int regressions = 0;
+    printf("%-32s %14s %8s %14s %10s %10s\n", "kernel", "ns/op", "cv%", "items/s", "GB/s", "vs base");
+    for (const MicroKernel& kernel : kernels) {
+        if (!filter.empty() && kernel.name.find(filter) == std::string::npos) {
+            continue;
+        }
+        KernelStats stats = measure(kernel);
+        double opsPerSecond = 1.0e9 / stats.medianNs;
+        double cv = stats.meanNs > 0.0 ? stats.stddevNs / stats.meanNs * 100.0 : 0.0;
+
+        char comparison[32] = "-";
+        auto base = baseline.find(kernel.name);
+        if (base != baseline.end() && base->second > 0.0) {
+            double change = stats.medianNs / base->second - 1.0;
+            snprintf(comparison, sizeof(comparison), "%+.1f%%", change * 100.0);
+            if (change > threshold) {
+                regressions++;
+            }
+        }
+
+        printf("%-32s %14.2f %8.1f %14.3g %10.2f %10s\n", kernel.name.c_str(), stats.medianNs, cv,
+               kernel.itemsPerOp * opsPerSecond, kernel.bytesPerOp * opsPerSecond / 1.0e9, comparison);
+        if (base != baseline.end() && stats.medianNs > base->second * (1.0 + threshold)) {
+            printf("  REGRESSION %s: %.2f ns/op vs baseline %.2f ns/op\n", kernel.name.c_str(), stats.medianNs, base->second);
+        }
+        newBaseline << kernel.name << "," << stats.medianNs << "\n";
+    }
+
+    if (!writeBaselinePath.empty()) {
+        std::ofstream out(writeBaselinePath);
+        out << newBaseline.str();
+        std::cout << "Wrote baseline to " << writeBaselinePath << std::endl;
+    }
+
+    if (window != nullptr) {
+        glfwTerminate();
+    }
+
+    if (mismatches > 0) {
+        std::cout << "FAILED: " << mismatches << " correctness check(s) failed (see ERROR lines above)" << std::endl;
+        return 1;
+    }
+    if (regressions > 0 && failOnRegression) {
+        std::cout << "FAILED: " << regressions << " kernel(s) regressed more than " << threshold * 100.0
+                  << "% against " << baselinePath << std::endl;
+        return 1;
+    }
+    if (regressions > 0) {
+        // timings vary run to run on a shared machine, so by default the comparison is a report
+        std::cout << regressions << " kernel(s) regressed more than " << threshold * 100.0 << "% against " << baselinePath
+                  << " (report only; pass --fail-on-regression to fail the run)" << std::endl;
+    }
+    if (baseline.empty()) {
+        std::cout << "No baseline at " << baselinePath << "; nothing compared" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#ifndef MICROBENCH_H
+#define MICROBENCH_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// One timed kernel. body(iterations) runs the kernel that many times.
+struct MicroKernel {
+    std::string name;
+    std::function<void(long long iterations)> body;
+    double itemsPerOp;            // e.g. vertices transformed per call (0 = not applicable)
+    double bytesPerOp;            // bytes read + written per call (0 = not applicable)
+};
+
+// Kernel groups; each appends its kernels to the list
+void addMathKernels(std::vector<MicroKernel>& kernels);
+void addBufferKernels(std::vector<MicroKernel>& kernels);     // needs a current GL context
+
+// ndbench micro [--gpu] [--filter substring] [--baseline path] [--threshold 0.25] [--fail-on-regression] [--write-baseline path]
+// Returns non-zero when a kernel's correctness check (e.g. the dual of a hypercube being a
+// cross-polytope) failed. Kernels slower than the baseline by more than the threshold are
+// reported; they fail the run only with --fail-on-regression.
+int runMicrobenchmarks(int argc, char** argv);
+
+#endif
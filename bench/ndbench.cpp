@@ -0,0 +1,365 @@
+// ndbench: end-to-end benchmark over every registered object (family x dimension).
+//
+//   ndbench [--mode cpu|gpu] [--frames M] [--format float32|half|snorm16|snorm8] [--instances K] [--csv path] [--json path]
+//   ndbench micro [...]     kernel microbenchmarks, see microbench.h
+//
+// cpu  runs the CPU mirror of the vertex shaders (projection.h) plus a view/projection
+//      transform and a per-edge screen-space setup, so it needs no GPU and is comparable
+//      across hosts.
+// gpu  renders M frames of each object offscreen through the normal draw path,
+//      with glFinish() after each frame so the timing covers the GPU work.
+//      --format picks the vertex buffer storage (see vertex_format.h).
+//      --instances draws K copies of each object per frame instead (instanced_objects.h),
+//      rotated in the shader, to find the vertex throughput ceiling of a driver.
+//
+// Results go to stdout as CSV, and optionally to CSV/JSON files for comparing builds.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "hypercube_objects.h"
+#include "frame_state.h"
+#include "projection.h"
+#include "instanced_objects.h"
+#include "microbench.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// ndim_object.h draws with these globals
+float EDGE_THICKNESS = 1.0f;
+float VERTEX_SIZE = 1.0f;
+
+struct BenchResult {
+    std::string name;
+    int family;
+    int dimensions;
+    int frames;
+    int vertexCount;              // distinct vertices transformed per frame
+    int edgeCount;
+    int instances;                // copies drawn per frame (1 unless --instances)
+    double msPerFrame;
+    double verticesPerSecond;
+    double edgesPerSecond;
+    double instancesPerSecond;
+};
+
+static const int BENCH_WIDTH = 1280;
+static const int BENCH_HEIGHT = 720;
+static const float BENCH_FPS = 60.0f;
+
+// Peak resident set of the whole process so far (every object's run included), not per object
+static long long processPeakMemoryKB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return (long long)(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+// View/projection used by both modes: the same orbit camera as the app at frame time t
+static glm::mat4 benchViewProjection(const FrameState& state) {
+    glm::mat4 view = glm::lookAt(state.cameraPosition, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)BENCH_WIDTH / (float)BENCH_HEIGHT, 0.1f, 100.0f);
+    return projection * view;
+}
+
+static double runCpuFrames(const NDimObjectData& object, int frames, double& checksum) {
+    std::vector<float> world((size_t)object.vertexCount * 3);
+    auto start = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < frames; frame++) {
+        FrameState state = computeFrameState(object, frameSceneTime(frame, BENCH_FPS, 1.0f), 0.7f, 4.0f, 1.0f);
+        glm::mat4 viewProjection = benchViewProjection(state);
+
+        transformVertices(state.rotationMatrix, object.dimensions, object.scale,
+                          object.vertices, object.vertexCount, world.data());
+
+        // line setup: clip -> screen for both endpoints, accumulate pixel length
+        for (int edge = 0; edge < object.edgeCount; edge++) {
+            float screen[2][2];
+            for (int e = 0; e < 2; e++) {
+                const float* p = &world[(size_t)object.edges[2 * edge + e] * 3];
+                glm::vec4 clip = viewProjection * glm::vec4(p[0], p[1], p[2], 1.0f);
+                float invW = clip.w != 0.0f ? 1.0f / clip.w : 0.0f;
+                screen[e][0] = (clip.x * invW * 0.5f + 0.5f) * BENCH_WIDTH;
+                screen[e][1] = (clip.y * invW * 0.5f + 0.5f) * BENCH_HEIGHT;
+            }
+            float dx = screen[1][0] - screen[0][0];
+            float dy = screen[1][1] - screen[0][1];
+            checksum += std::sqrt(dx * dx + dy * dy);
+        }
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double runGpuFrames(NDimObjectData& object, int frames, VertexFormat format) {
+    object.vertexFormat = format;
+    object.init();
+    object.shader->use();
+    glFinish();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        FrameState state = computeFrameState(object, frameSceneTime(frame, BENCH_FPS, 1.0f), 0.7f, 4.0f, 1.0f);
+        glm::mat4 view = glm::lookAt(state.cameraPosition, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)BENCH_WIDTH / (float)BENCH_HEIGHT, 0.1f, 100.0f);
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        object.shader->setFloatArray("rotationMat", state.rotationMatrix, object.matrixSize());
+        object.shader->setFloat("scale", object.scale);
+        object.shader->setMat4("view", view);
+        object.shader->setMat4("projection", projection);
+        object.draw();
+        glFinish();
+    }
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    object.cleanup();
+    return elapsed;
+}
+
+static double runGpuInstancedFrames(NDimObjectData& object, int frames, int instances) {
+    Shader shader("shaders/instanced.v", "shaders/ws-coloring.f");
+    InstancedObjects copies;
+    copies.init();
+    copies.setObject(object);
+    copies.setInstanceCount(instances);
+    shader.use();
+    glFinish();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        FrameState state = computeFrameState(object, frameSceneTime(frame, BENCH_FPS, 1.0f), 0.7f, 4.0f, 1.0f);
+        glm::mat4 view = glm::lookAt(state.cameraPosition, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        glm::mat4 projection = glm::perspective(glm::radians(45.0f), (float)BENCH_WIDTH / (float)BENCH_HEIGHT, 0.1f, 100.0f);
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        shader.setMat4("view", view);
+        shader.setMat4("projection", projection);
+        copies.draw(shader, state.sceneTime);
+        glFinish();
+    }
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    copies.cleanup();
+    glDeleteProgram(shader.ID);
+    return elapsed;
+}
+
+static void writeCsv(FILE* out, const std::vector<BenchResult>& results, const std::string& mode, long long peakMemoryKB) {
+    fprintf(out, "mode,name,family,dimensions,frames,vertices_per_frame,ms_per_frame,vertices_per_s,edges_per_s,instances,instances_per_s\n");
+    for (const BenchResult& r : results) {
+        fprintf(out, "%s,%s,%d,%d,%d,%d,%.6f,%.0f,%.0f,%d,%.0f\n", mode.c_str(), r.name.c_str(), r.family, r.dimensions,
+                r.frames, r.vertexCount, r.msPerFrame, r.verticesPerSecond, r.edgesPerSecond,
+                r.instances, r.instancesPerSecond);
+    }
+    fprintf(out, "# process_peak_memory_kb %lld\n", peakMemoryKB);
+}
+
+static void writeJson(FILE* out, const std::vector<BenchResult>& results, const std::string& mode, const std::string& renderer,
+                      long long peakMemoryKB) {
+#ifdef NDEBUG
+    const char* buildType = "release";
+#else
+    const char* buildType = "debug";
+#endif
+    fprintf(out, "{\n  \"mode\": \"%s\",\n  \"build\": \"%s\",\n  \"hardware_threads\": %u,\n  \"renderer\": \"%s\",\n"
+                 "  \"process_peak_memory_kb\": %lld,\n  \"results\": [\n",
+            mode.c_str(), buildType, std::thread::hardware_concurrency(), renderer.c_str(), peakMemoryKB);
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        fprintf(out, "    {\"name\": \"%s\", \"family\": %d, \"dimensions\": %d, \"frames\": %d, \"vertices_per_frame\": %d, "
+                     "\"ms_per_frame\": %.6f, \"vertices_per_s\": %.0f, \"edges_per_s\": %.0f, "
+                     "\"instances\": %d, \"instances_per_s\": %.0f}%s\n",
+                r.name.c_str(), r.family, r.dimensions, r.frames, r.vertexCount, r.msPerFrame,
+                r.verticesPerSecond, r.edgesPerSecond, r.instances, r.instancesPerSecond,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::string(argv[1]) == "micro") {
+        return runMicrobenchmarks(argc - 1, argv + 1);
+    }
+
+    std::string mode = "cpu";
+    int frames = 600;
+    std::string csvPath;
+    std::string jsonPath;
+    VertexFormat format = VERTEX_FORMAT_FLOAT32;
+    int instances = 0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--mode" && hasValue) {
+            mode = argv[++i];
+        }
+        else if (arg == "--frames" && hasValue) {
+            frames = atoi(argv[++i]);
+        }
+        else if (arg == "--format" && hasValue) {
+            std::string name = argv[++i];
+            if (name == "float32") {
+                format = VERTEX_FORMAT_FLOAT32;
+            }
+            else if (name == "half") {
+                format = VERTEX_FORMAT_HALF;
+            }
+            else if (name == "snorm16") {
+                format = VERTEX_FORMAT_SNORM16;
+            }
+            else if (name == "snorm8") {
+                format = VERTEX_FORMAT_SNORM8;
+            }
+            else {
+                std::cout << "Unknown vertex format " << name << std::endl;
+                return -1;
+            }
+        }
+        else if (arg == "--instances" && hasValue) {
+            instances = atoi(argv[++i]);
+        }
+        else if (arg == "--csv" && hasValue) {
+            csvPath = argv[++i];
+        }
+        else if (arg == "--json" && hasValue) {
+            jsonPath = argv[++i];
+        }
+        else {
+            std::cout << "usage: ndbench [--mode cpu|gpu] [--frames M] [--format float32|half|snorm16|snorm8] [--instances K] [--csv path] [--json path]" << std::endl;
+            return -1;
+        }
+    }
+    if ((mode != "cpu" && mode != "gpu") || frames <= 0) {
+        std::cout << "Invalid mode or frame count" << std::endl;
+        return -1;
+    }
+    if (instances < 0 || instances > MAX_INSTANCES || (instances > 0 && mode != "gpu")) {
+        std::cout << "--instances takes 1 to " << MAX_INSTANCES << " copies, in gpu mode" << std::endl;
+        return -1;
+    }
+
+    GLFWwindow* window = nullptr;
+    std::string renderer = "cpu";
+    if (mode == "gpu") {
+        glfwInit();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        window = glfwCreateWindow(BENCH_WIDTH, BENCH_HEIGHT, "ndbench", NULL, NULL);
+        if (window == NULL) {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSwapInterval(0);
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            return -1;
+        }
+        glViewport(0, 0, BENCH_WIDTH, BENCH_HEIGHT);
+        glEnable(GL_DEPTH_TEST);
+        renderer = (const char*)glGetString(GL_RENDERER);
+    }
+
+    ObjectMap objects;
+    populateObjectMap(objects);
+
+    std::vector<BenchResult> results;
+    double checksum = 0.0;
+    for (auto& entry : objects) {
+        NDimObjectData& object = *entry.second;
+        object.initIdentityMatrix();
+
+        if (instances > 0 && object.dimensions > MAX_INSTANCED_DIMENSIONS) {
+            continue;
+        }
+        double elapsedMs;
+        if (instances > 0) {
+            elapsedMs = runGpuInstancedFrames(object, frames, instances);
+        }
+        else {
+            elapsedMs = mode == "gpu" ? runGpuFrames(object, frames, format) : runCpuFrames(object, frames, checksum);
+        }
+        double seconds = elapsedMs / 1000.0;
+        int copies = std::max(instances, 1);
+
+        BenchResult result;
+        result.name = object.name;
+        result.family = entry.first.first;
+        result.dimensions = entry.first.second;
+        result.frames = frames;
+        result.vertexCount = object.vertexCount * copies;
+        result.edgeCount = object.edgeCount;
+        result.instances = copies;
+        result.msPerFrame = elapsedMs / frames;
+        result.verticesPerSecond = seconds > 0.0 ? (double)object.vertexCount * copies * frames / seconds : 0.0;
+        result.edgesPerSecond = seconds > 0.0 ? (double)object.edgeCount * copies * frames / seconds : 0.0;
+        result.instancesPerSecond = seconds > 0.0 ? (double)copies * frames / seconds : 0.0;
+        results.push_back(result);
+    }
+
+    long long peakMemoryKB = processPeakMemoryKB();
+    writeCsv(stdout, results, mode, peakMemoryKB);
+    if (!csvPath.empty()) {
+        FILE* file = fopen(csvPath.c_str(), "w");
+        if (file != nullptr) {
+            writeCsv(file, results, mode, peakMemoryKB);
+            fclose(file);
+        }
+        else {
+            std::cout << "Could not write " << csvPath << std::endl;
+        }
+    }
+    if (!jsonPath.empty()) {
+        FILE* file = fopen(jsonPath.c_str(), "w");
+        if (file != nullptr) {
+            writeJson(file, results, mode, renderer, peakMemoryKB);
+            fclose(file);
+        }
+        else {
+            std::cout << "Could not write " << jsonPath << std::endl;
+        }
+    }
+    // printed so the CPU work can't be optimized away
+    std::cout << "# checksum " << checksum << std::endl;
+
+    if (window != nullptr) {
+        glfwTerminate();
+    }
+    return 0;
+}
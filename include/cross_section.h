@@ -0,0 +1,71 @@
+#pragma once
+#ifndef CROSS_SECTION_H
+#define CROSS_SECTION_H
+
+#include <cstdint>
+#include <vector>
+#include "ndim_object.h"
+
+// Cross-sections of an object by the moving hyperplane {x : (R x)[N-1] = offset}, R being the
+// frame's rotation: the hyperplane orthogonal to the axis the shaders' first perspective step
+// divides by. The section, an (N-1)-polytope, is kept in the object's own coordinates, so the
+// object's shader and rotation draw it in place.
+// Vertices are classified by signed distance four at a time (SSE, from a structure-of-arrays
+// copy) into a sign bitmask, and only edges with endpoints on both sides are cut. The section's
+// edges join the two cut edges of every 2-face (from the face lattice; objects without one get
+// the section's vertices only). While the bitmask is unchanged from the previous frame its
+// topology is kept and only the cut points move.
+class CrossSection {
+public:
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    // Slice this object from now on (nothing to do when it is already the current one)
+    void setObject(const NDimObjectData& object);
+
+    // Cut the object with this frame's rotation (row-major, dims x dims) at the given offset.
+    // Returns whether the topology had to be rebuilt.
+    bool update(const float* rotation, float offset);
+
+    // Upload and draw the section; the object's shader must be in use with its uniforms set.
+    // Edges or vertices drawn otherwise (ThickLines, VertexSprites) can be left out.
+    void draw(Shader& shader, bool edges = true, bool vertices = true);
+
+    float circumradius() const { return radius; }
+    int vertexCount() const { return (int)(cutEnds.size() / 2); }
+    int edgeCount() const { return (int)(sectionEdges.size() / 2); }
+    const std::vector<float>& vertices() const { return sectionVertices; }   // dims floats each
+    const std::vector<unsigned int>& edges() const { return sectionEdges; }
+
+private:
+    void classify(const float* normal, float offset);
+    void rebuildTopology();
+
+    const NDimObjectData* object = nullptr;
+    unsigned int objectGeneration = 0;       // detects the object's geometry being reloaded
+    int dims = 0;
+    int count = 0;
+    int paddedCount = 0;                      // count rounded up to the SIMD width
+    float radius = 0.0f;
+
+    std::vector<float> components;            // coordinate j of vertex v at j * paddedCount + v
+    std::vector<unsigned int> edgeEnds;       // vertex pairs: the lattice's 1-faces, else the object's edges
+    std::vector<float> distance;
+    std::vector<uint32_t> below;              // bit v: vertex v is on the negative side
+    std::vector<uint32_t> previousBelow;      // empty until the first topology is built
+
+    std::vector<unsigned int> cutEdges;       // edge index of each section vertex
+    std::vector<unsigned int> cutEnds;
+    std::vector<unsigned int> sectionEdges;
+    std::vector<int> faceCut;                 // per 2-face, scratch: first cut edge found on it
+    std::vector<float> sectionVertices;
+
+    // GL
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+    unsigned int EBO = 0;
+    int attributeDims = 0;                    // layout currently set up in the VAO
+    bool indicesDirty = true;
+};
+
+#endif
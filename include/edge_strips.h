@@ -0,0 +1,17 @@
+#pragma once
+#ifndef EDGE_STRIPS_H
+#define EDGE_STRIPS_H
+
+#include <vector>
+
+// Index that ends one line strip and starts the next (GL primitive restart)
+const unsigned int STRIP_RESTART_INDEX = 0xFFFFFFFFu;
+
+// Cover every edge exactly once with as few line strips as possible, separated by
+// STRIP_RESTART_INDEX. Each component gets an Euler circuit (Hierholzer); odd-degree
+// vertices are first paired up with virtual edges, and the circuit is cut at those,
+// so a graph with k odd vertices needs k/2 strips. Even-dimensional hypercubes and
+// simplices, and every cross-polytope, come out as a single strip of edges + 1 indices.
+void buildLineStrips(int vertexCount, const unsigned int* edges, int edgeCount, std::vector<unsigned int>& indices);
+
+#endif
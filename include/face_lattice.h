@@ -0,0 +1,58 @@
+#pragma once
+#ifndef FACE_LATTICE_H
+#define FACE_LATTICE_H
+
+#include <cstddef>
+#include <vector>
+#include "polytope_generators.h"
+
+// Face lattice of a convex N-polytope: every k-face for k = 0 (vertices) .. N-1 (facets),
+// with its vertex set and its incidences to the faces one rank below and above.
+// Faces have global ids ordered by rank; the rank-0 faces are the vertices in index order.
+// All incidence is stored as CSR (an offsets array of faceCount + 1 entries into a flat list).
+struct FaceLattice {
+    int dimensions = 0;
+    std::vector<unsigned int> rankOffsets;      // faces of rank k are [rankOffsets[k], rankOffsets[k + 1])
+    std::vector<unsigned int> vertexOffsets;    // face -> sorted vertex indices
+    std::vector<unsigned int> vertexIndices;
+    std::vector<unsigned int> boundaryOffsets;  // face -> (k-1)-faces on its boundary (none for vertices)
+    std::vector<unsigned int> boundaryFaces;
+    std::vector<unsigned int> cofaceOffsets;    // face -> (k+1)-faces containing it (none for facets)
+    std::vector<unsigned int> cofaces;
+
+    bool empty() const { return rankOffsets.empty(); }
+    int totalFaces() const { return empty() ? 0 : (int)rankOffsets.back(); }
+    int faceCount(int rank) const { return (int)(rankOffsets[rank + 1] - rankOffsets[rank]); }
+    int firstFace(int rank) const { return (int)rankOffsets[rank]; }
+    int faceVertexCount(int face) const { return (int)(vertexOffsets[face + 1] - vertexOffsets[face]); }
+    const unsigned int* faceVertices(int face) const { return vertexIndices.data() + vertexOffsets[face]; }
+    int boundaryCount(int face) const { return (int)(boundaryOffsets[face + 1] - boundaryOffsets[face]); }
+    const unsigned int* boundary(int face) const { return boundaryFaces.data() + boundaryOffsets[face]; }
+    int cofaceCount(int face) const { return (int)(cofaceOffsets[face + 1] - cofaceOffsets[face]); }
+    const unsigned int* coface(int face) const { return cofaces.data() + cofaceOffsets[face]; }
+
+    // f-vector (f_0, ..., f_{N-1})
+    std::vector<int> fVector() const;
+};
+
+// Build the lattice from the mesh's facet-vertex incidence. A facet's ridges are the
+// inclusion-maximal proper intersections with the other facets; below that, a k-face's
+// (k-1)-faces are its maximal intersections with the other k-faces of a (k+1)-face
+// containing it. Faces of one rank are processed in parallel (threadCount 0 = hardware concurrency). Returns false
+// (printing why) when the mesh has no facets or the facets do not form a polytope.
+bool buildFaceLattice(const PolytopeMesh& mesh, FaceLattice& lattice, int threadCount = 0);
+
+// Lattice of the dual polytope: the primal k-faces become (N-1-k)-faces in the same order,
+// boundary and cofaces swap, and each face's vertex set is the facets containing the primal
+// face (the dual's vertices are the primal facets in index order). Each face's set is merged
+// from its cofaces' sets, so the cost is linear in the size of the result.
+void dualFaceLattice(const FaceLattice& lattice, FaceLattice& dual);
+
+// Flat uint32 form stored in the polytope cache's lattice section. Cofaces are not
+// stored; deserializeFaceLattice rebuilds them. It fails (printing why) unless the offsets
+// are consistent, the rank-0 faces are exactly the mesh's vertexCount vertices and every
+// vertex and boundary index is in range.
+void serializeFaceLattice(const FaceLattice& lattice, std::vector<unsigned int>& words);
+bool deserializeFaceLattice(const unsigned int* words, size_t wordCount, int vertexCount, FaceLattice& lattice);
+
+#endif
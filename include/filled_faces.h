@@ -0,0 +1,58 @@
+#pragma once
+#ifndef FILLED_FACES_H
+#define FILLED_FACES_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "ndim_object.h"
+#include "radix_sort.h"
+
+// Semi-transparent 2-faces of an object, drawn over its edges with the object's shader.
+// Every 2-face of the face lattice (the polygon itself for a 2D object) is put in cyclic
+// order once and fan-triangulated. Each frame the faces are depth sorted back to front by
+// their centroids in projected (3D world) space, seen from the camera, with a radix sort
+// over the view-space depths, and the triangles are re-emitted in that order.
+class FilledFaces {
+public:
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    // Fill this object's faces from now on (nothing to do when it is already the current one)
+    void setObject(const NDimObjectData& object);
+
+    // Sort the faces for this frame's rotation (row-major, dims x dims), the object's scale and the camera
+    void update(const float* rotation, float scale, const glm::mat4& view);
+
+    // Upload and draw the sorted triangles blended at the given opacity, without writing depth;
+    // the object's shader must be in use with its uniforms set. With blend false the caller's
+    // blending (a transparent render path) is left alone and opacity is unused.
+    void draw(Shader& shader, float opacity, bool blend = true);
+
+    int faceCount() const { return cornerOffsets.empty() ? 0 : (int)cornerOffsets.size() - 1; }
+    int triangleCount() const { return (int)(indices.size() / 3); }
+    const std::vector<uint32_t>& order() const { return faceOrder; }    // face indices, back to front
+    const std::vector<uint32_t>& depthKeys() const { return keys; }     // floatSortKey of each depth, in order
+
+private:
+    const NDimObjectData* object = nullptr;
+    unsigned int objectGeneration = 0;       // detects the object's geometry being reloaded
+    int dims = 0;
+
+    std::vector<unsigned int> corners;        // every face's vertices in cyclic order
+    std::vector<unsigned int> cornerOffsets;  // face f is [cornerOffsets[f], cornerOffsets[f + 1])
+
+    std::vector<float> world;                 // projected vertices, 3 floats each
+    std::vector<uint32_t> keys;
+    std::vector<uint32_t> faceOrder;
+    RadixSortScratch sortScratch;
+    std::vector<unsigned int> indices;        // triangles of the faces in sorted order
+
+    // GL
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+    unsigned int EBO = 0;
+    bool verticesDirty = true;
+};
+
+#endif
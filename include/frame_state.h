@@ -0,0 +1,41 @@
+#pragma once
+#ifndef FRAME_STATE_H
+#define FRAME_STATE_H
+
+#include <cmath>
+#include <glm/glm.hpp>
+#include "ndim_object.h"
+
+// Largest rotation matrix any object can request (8D = 64 floats)
+const int MAX_ROTATION_MATRIX_SIZE = 64;
+
+// Everything that animates in a frame. It is a pure function of scene time, so the
+// live loop and the offline renderer produce identical frames for the same time.
+struct FrameState {
+    float sceneTime;                               // animation time in seconds (already scaled by timeRatio)
+    float cameraAngle;                             // camera orbit angle around the origin (radians)
+    glm::vec3 cameraPosition;
+    float rotationMatrix[MAX_ROTATION_MATRIX_SIZE];
+};
+
+// Scene time of a given offline frame. Computed in double so that long renders
+// (hundreds of thousands of frames) don't accumulate rounding drift.
+inline float frameSceneTime(int frameIndex, float fps, float timeRatio) {
+    return static_cast<float>(static_cast<double>(frameIndex) / fps * timeRatio);
+}
+
+// Build the state of a frame from scene time alone
+// orbitRate is the camera orbit speed relative to scene time (radians per second)
+inline FrameState computeFrameState(const NDimObjectData& object, float sceneTime,
+                                    float orbitRate, float orbitRadius, float cameraHeight) {
+    FrameState state;
+    state.sceneTime = sceneTime;
+    state.cameraAngle = sceneTime * orbitRate;
+    state.cameraPosition = glm::vec3(orbitRadius * cos(state.cameraAngle),
+                                     cameraHeight,
+                                     orbitRadius * sin(state.cameraAngle));
+    object.buildRotationMatrix(state.rotationMatrix, sceneTime);
+    return state;
+}
+
+#endif
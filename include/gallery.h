@@ -0,0 +1,56 @@
+#pragma once
+#ifndef GALLERY_H
+#define GALLERY_H
+
+#include <vector>
+#include "hypercube_objects.h"
+
+// Uniform block capacity of shaders/gallery.v
+const int MAX_GALLERY_OBJECTS = 32;
+const int MAX_GALLERY_DIMENSIONS = 8;
+
+// Every object of the map at once, laid out in a grid. All vertices share one buffer (and
+// buffer texture) with an object index per vertex, all edge strips one element buffer, and
+// the per-object rotation, scale and grid cell one uniform buffer that shaders/gallery.v
+// indexes. The whole grid is one glMultiDrawElements for the edges and one glMultiDrawArrays
+// for the vertices, with a single program and a single uniform buffer upload per frame.
+class Gallery {
+public:
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    // Pack the objects into the shared buffers (nothing to upload when none changed since the
+    // last call). Objects above MAX_GALLERY_DIMENSIONS are left out.
+    void setObjects(const ObjectMap& objects);
+
+    // Rotations at sceneTime and grid cells for a width x height target, in one upload
+    void update(float sceneTime, int width, int height);
+
+    // Draw the grid. The gallery shader (renderPathGalleryShader) must be in use with the
+    // camera uniforms set.
+    void draw(Shader& shader);
+
+    int objectCount() const { return (int)entries.size(); }
+
+private:
+    struct Entry {
+        const NDimObjectData* object;
+        unsigned int geometryGeneration;      // detects the object's geometry being reloaded
+    };
+    std::vector<Entry> entries;
+    std::vector<GLint> vertexFirst;           // glMultiDrawArrays ranges, one per object
+    std::vector<GLsizei> vertexCounts;
+    std::vector<const void*> stripOffsets;    // glMultiDrawElements ranges, objects with edges only
+    std::vector<GLsizei> stripCounts;
+    std::vector<float> blockData;             // GalleryObjects block (std140)
+
+    // GL
+    unsigned int VAO = 0;
+    unsigned int objectIndexBuffer = 0;       // uint per vertex
+    unsigned int vertexBuffer = 0;            // backs vertexTexture
+    unsigned int vertexTexture = 0;           // GL_R32F buffer texture
+    unsigned int EBO = 0;                     // every object's strips, restart separated
+    unsigned int UBO = 0;
+};
+
+#endif
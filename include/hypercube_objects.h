@@ -2,7 +2,16 @@
 #ifndef HYPERCUBE_OBJECTS_H
 #define HYPERCUBE_OBJECTS_H
 
+#include <map>
+#include <utility>
 #include "ndim_object.h"
+#include "polytope_operators.h"
+
+// Objects keyed by (shapeType, dimension)
+typedef std::map<std::pair<int, int>, NDimObjectData*> ObjectMap;
+
+// shapeType runs from 0 (hypercube) to SHAPE_TYPE_COUNT - 1 (zonotope)
+const int SHAPE_TYPE_COUNT = 10;
 
 // Extern declarations for hypercube objects
 extern NDimObjectData hypercube2D;
@@ -29,5 +38,53 @@ extern NDimObjectData crossPolytope6D;
 extern NDimObjectData crossPolytope7D;
 extern NDimObjectData crossPolytope8D;
 
+extern NDimObjectData cell24;
+extern NDimObjectData cell120;
+extern NDimObjectData cell600;
+extern NDimObjectData gosset421;
+extern NDimObjectData pointHull;
+extern NDimObjectData duoprism;
+extern NDimObjectData zonotope;
+
+const int DUOPRISM_MAX_SIDES = 64;
+
+// Take "--points <file>" and "--zonotope <file>" out of argv. The Point Hull object then uses
+// that point set (see loadPointSet) instead of random points on the 3-sphere, and the Zonotope
+// object that file's vectors (same format) as its generators instead of the cyclic ones.
+void parsePointSetArgs(int& argc, char** argv);
+
+// Sides of the two polygons whose product is the Duoprism object (5 x 7 by default).
+// Setting them reloads its geometry (cached per p, q) but not its OpenGL buffers:
+// call duoprism.deleteBuffers() and duoprism.setupBuffers() afterwards. If the new
+// geometry fails to load, the previous sides and geometry are kept.
+void getDuoprismSides(int& p, int& q);
+void setDuoprismSides(int p, int q);
+
+// Number of cyclic generators of the Zonotope object (12 by default; see generateCyclicGenerators).
+// Setting it reloads the geometry like setDuoprismSides (keeping the previous count and
+// geometry if that fails), unless the generators came from a file.
+int getZonotopeGeneratorCount();
+void setZonotopeGeneratorCount(int count);
+bool zonotopeGeneratorsFromFile();
+
+// The object's face lattice, deserialized from its polytope cache file on first use (for 4_21,
+// whose hull takes seconds, generated and cached only then). Sets object.lattice and bumps its
+// geometryGeneration; nullptr when the object has no lattice.
+const FaceLattice* loadLattice(NDimObjectData& object);
+
+// Polar dual of an object with a face lattice (nullptr without one), built and initialized
+// on first use, including its OpenGL buffers; rebuilt after the object's geometry is reloaded
+NDimObjectData* dualObject(NDimObjectData& object);
+
+// The object with a polytope operator applied (nullptr without a lattice), built the same
+// way; the result and its lattice are stored in the polytope cache per operator and geometry
+NDimObjectData* operatedObject(NDimObjectData& object, PolytopeOperator op);
+
+// Free every dual and operated object
+void cleanupDerivedObjects();
+
+// Register every built-in object and map its geometry from the polytope cache,
+// generating any missing cache files first (does not touch OpenGL or load lattices)
+void populateObjectMap(ObjectMap& objectMap);
 
 #endif
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef INSTANCED_OBJECTS_H
+#define INSTANCED_OBJECTS_H
+
+#include <vector>
+#include "ndim_object.h"
+
+// Uniform capacity of shaders/instanced.v
+const int MAX_INSTANCED_PLANES = 16;
+const int MAX_INSTANCED_DIMENSIONS = 8;
+const int MAX_INSTANCES = 1 << 20;
+
+// Load test: thousands of copies of one object, each at its own place in a 3D lattice and
+// its own rotation phase. The per-instance data is one instanced vec4 attribute, and
+// shaders/instanced.v rebuilds every copy's rotation from the object's rotation planes,
+// so the CPU cost per frame does not grow with the instance count. One instanced draw for
+// the edges (line strips) and one for the vertices.
+class InstancedObjects {
+public:
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    // Draw copies of this object from now on (nothing to upload when it is already the current
+    // one). Objects above MAX_INSTANCED_DIMENSIONS are not drawn.
+    void setObject(const NDimObjectData& object);
+
+    // Lay out count copies (clamped to [1, MAX_INSTANCES]) with deterministic phases
+    void setInstanceCount(int count);
+
+    // Draw every copy at sceneTime. The instanced shader (renderPathInstancedShader) must be in
+    // use with the camera uniforms set.
+    void draw(Shader& shader, float sceneTime);
+
+    int instanceCount() const { return instances; }
+    long long verticesPerFrame() const { return object != nullptr ? (long long)object->vertexCount * instances : 0; }
+    long long edgesPerFrame() const { return object != nullptr ? (long long)object->edgeCount * instances : 0; }
+
+private:
+    const NDimObjectData* object = nullptr;
+    unsigned int objectGeneration = 0;       // detects the object's geometry being reloaded
+    int instances = 0;
+    int stripIndexCount = 0;
+    float spacing = 1.0f;                     // lattice step; copies are scaled to fit in it
+
+    // GL
+    unsigned int VAO = 0;
+    unsigned int instanceBuffer = 0;          // vec4 per instance
+    unsigned int vertexBuffer = 0;            // backs vertexTexture
+    unsigned int vertexTexture = 0;           // GL_R32F buffer texture
+    unsigned int EBO = 0;                     // line strips, restart separated
+};
+
+#endif
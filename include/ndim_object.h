@@ -5,8 +5,14 @@
 #include <cstddef>
 #include <cstring>
 #include <cmath>
+#include <vector>
 #include <glad/glad.h>
 #include "shader_s.h"
+#include "trace.h"
+#include "edge_strips.h"
+#include "vertex_format.h"
+
+struct FaceLattice;
 
 extern float EDGE_THICKNESS;
 extern float VERTEX_SIZE;
@@ -28,11 +34,39 @@ inline void generateIdentityMatrix(float* matrix, int N) {
     }
 }
 
+// Point vertex attributes 0, 1, ... at the bound GL_ARRAY_BUFFER: dimensions coordinates per
+// vertex in the given format, one vec4 group per attribute (the last may have fewer components).
+// Attributes from there up to attributeSlots are disabled, for VAOs reused across dimensions.
+inline void setupVertexAttributes(int dimensions, VertexFormat format, int attributeSlots = 0) {
+    int groups = (dimensions + 3) / 4;
+    for (int i = 0; i < groups || i < attributeSlots; i++) {
+        if (i >= groups) {
+            glDisableVertexAttribArray(i);
+            continue;
+        }
+        glEnableVertexAttribArray(i);
+
+        // Calculate how many components in this vec4 (could be less than 4 for the last group)
+        int componentsInThisGroup = (i == groups - 1 && dimensions % 4 != 0)
+            ? dimensions % 4
+            : 4;
+
+        glVertexAttribPointer(
+            i,                                          // attribute location
+            componentsInThisGroup,                      // number of components (1-4)
+            vertexFormatGLType(format),                 // type
+            vertexFormatNormalized(format),             // normalized?
+            vertexFormatStride(format, dimensions),     // stride
+            (void*)(size_t)(i * 4 * vertexFormatComponentBytes(format))   // offset
+        );
+    }
+}
+
 struct NDimObjectData {
     // Vertex data
-    const float* vertices;
-    size_t vertexDataSize;        // sizeof(vertices) in bytes
-    int vertexCount;              // Total number of vertices
+    const float* vertices;        // vertex table, dimensions floats per vertex
+    size_t vertexDataSize;        // size of the vertex table in bytes
+    int vertexCount;              // Number of distinct vertices
     int dimensions;                // N (2, 3, 4, 5, 6, 7, etc.)
 
     // Rotation configuration
@@ -44,7 +78,7 @@ struct NDimObjectData {
     float scale;                   // Uniform scale factor applied to all dimensions
 
     // Rendering mode
-    bool renderEdges;              // If true, render edges (GL_LINES); if false, render only vertices
+    bool renderEdges;              // If true, render edges (line strips); if false, render only vertices
 
     // OpenGL resources
     unsigned int VAO;
@@ -56,11 +90,34 @@ struct NDimObjectData {
     const char* shaderVertPath;
     const char* shaderFragPath;
 
+    // Line strips built from the edge list by setupBuffers
+    unsigned int EBO = 0;
+    int stripIndexCount = 0;      // element count, restart indices included
+
+    // Vertex buffer storage (defaults to Float32); snorm formats are dequantized by positionScale
+    VertexFormat vertexFormat = VERTEX_FORMAT_FLOAT32;
+    float positionScale = 1.0f;
+    size_t vertexBufferBytes = 0;
+
+    // Edges as vertex index pairs
+    const unsigned int* edges = nullptr;
+    int edgeCount = 0;
+
+    // Every k-face and its incidences (nullptr when not available or not loaded yet, see loadLattice)
+    const FaceLattice* lattice = nullptr;
+
+    // Largest vertex distance from the origin, computed when the geometry is loaded
+    float circumradius = 0.0f;
+
+    // Bumped whenever the geometry above is replaced, so anything built from it can tell it is
+    // stale (vertex addresses can be reused by the next load); 0 until the first load
+    unsigned int geometryGeneration = 0;
+
     // Helper functions
     int numVec4Groups() const { return (dimensions + 3) / 4; }
-    int stride() const { return dimensions * sizeof(float); }
+    int stride() const { return vertexFormatStride(vertexFormat, dimensions); }
     int attributeOffset(int groupIndex) const {
-        return groupIndex * 4 * sizeof(float);
+        return groupIndex * 4 * vertexFormatComponentBytes(vertexFormat);
     }
     int matrixSize() const { return dimensions * dimensions; }
 
@@ -106,61 +163,93 @@ struct NDimObjectData {
     }
 
     // Setup OpenGL buffers for this object
+    // Edges are drawn as line strips, about one index per edge
     void setupBuffers() {
+        std::vector<unsigned int> strips;
+        buildLineStrips(vertexCount, edges, edgeCount, strips);
+        stripIndexCount = (int)strips.size();
+
+        // Float32 uploads straight from the (memory-mapped) vertex table; other formats are encoded first
+        std::vector<unsigned char> encoded;
+        const void* bufferData = vertices;
+        vertexBufferBytes = vertexDataSize;
+        positionScale = 1.0f;
+        if (vertexFormat != VERTEX_FORMAT_FLOAT32) {
+            positionScale = encodeVertices(vertexFormat, vertices, vertexCount, dimensions, encoded);
+            bufferData = encoded.data();
+            vertexBufferBytes = encoded.size();
+        }
+
         glGenVertexArrays(1, &VAO);
         glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
 
         glBindVertexArray(VAO);
         glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        glBufferData(GL_ARRAY_BUFFER, vertexDataSize, vertices, GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, vertexBufferBytes, bufferData, GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, strips.size() * sizeof(unsigned int), strips.data(), GL_STATIC_DRAW);
 
         // Set up vertex attributes based on dimension
-        int numVec4Groups_local = numVec4Groups();
-
-        for (int i = 0; i < numVec4Groups_local; i++) {
-            glEnableVertexAttribArray(i);
-
-            // Calculate how many components in this vec4 (could be less than 4 for the last group)
-            int componentsInThisGroup = (i == numVec4Groups_local - 1 && dimensions % 4 != 0)
-                ? dimensions % 4
-                : 4;
-
-            glVertexAttribPointer(
-                i,                          // attribute location
-                componentsInThisGroup,      // number of components (1-4)
-                GL_FLOAT,                   // type
-                GL_FALSE,                   // normalized?
-                stride(),                   // stride
-                (void*)attributeOffset(i)   // offset
-            );
-        }
+        setupVertexAttributes(dimensions, vertexFormat);
 
         // unbind active vao
         glBindVertexArray(0);
     }
 
+    // Re-create the vertex buffers in another storage format
+    void setVertexFormat(VertexFormat format) {
+        deleteBuffers();
+        vertexFormat = format;
+        setupBuffers();
+    }
+
     // Initialize shader from paths
     void initShader() {
+        TraceScope trace("Shader compile", "gl");
         shader = new Shader(shaderVertPath, shaderFragPath);
     }
 
-    // Draw the object
+    // Draw the object (its shader must be in use)
     void draw() const {
-        glBindVertexArray(VAO);
+        draw(*shader);
+    }
 
+    // Draw the object with another program built on the same vertex shader (in use)
+    void draw(Shader& active) const {
         if (renderEdges) {
-            glLineWidth(EDGE_THICKNESS);
-            glDrawArrays(GL_LINES, 0, vertexCount);
+            drawEdges(active);
         }
+        drawVertices(active);
+    }
 
+    // Edges as GL line strips; wide lines may be clamped to 1px (ThickLines has no such limit)
+    void drawEdges(Shader& active) const {
+        active.setFloat("positionScale", positionScale);
+        glBindVertexArray(VAO);
+        glLineWidth(EDGE_THICKNESS);
+        glEnable(GL_PRIMITIVE_RESTART);
+        glPrimitiveRestartIndex(STRIP_RESTART_INDEX);
+        glDrawElements(GL_LINE_STRIP, stripIndexCount, GL_UNSIGNED_INT, (void*)0);
+        glDisable(GL_PRIMITIVE_RESTART);
+    }
+
+    void drawVertices(Shader& active) const {
+        active.setFloat("positionScale", positionScale);
+        glBindVertexArray(VAO);
         glPointSize(VERTEX_SIZE);
         glDrawArrays(GL_POINTS, 0, vertexCount);
     }
 
     // Cleanup OpenGL resources
-    void cleanup() {
+    void deleteBuffers() {
         glDeleteVertexArrays(1, &VAO);
         glDeleteBuffers(1, &VBO);
+        glDeleteBuffers(1, &EBO);
+    }
+
+    void cleanup() {
+        deleteBuffers();
         if (shader != nullptr) {
             delete shader;
             shader = nullptr;
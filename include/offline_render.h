@@ -0,0 +1,57 @@
+#pragma once
+#ifndef OFFLINE_RENDER_H
+#define OFFLINE_RENDER_H
+
+#include <functional>
+#include <string>
+
+// Settings for rendering an animation to numbered image files instead of a window.
+// Filled from the command line, e.g.:
+//   NDimProjector --offline --frames 36000 --fps 60 --family 0 --dim 8 --out frames --jobs 4
+struct OfflineRenderSettings {
+    bool enabled = false;
+    int width = 1920;
+    int height = 1080;
+    float fps = 60.0f;
+    int frameCount = 600;
+    float timeRatio = 1.0f;
+    int family = 0;                // shape type, as numbered in populateObjectMap
+    int dimension = 4;
+    bool dual = false;             // render the polar dual of the object (--dual)
+    int polytopeOperator = -1;     // PolytopeOperator applied first, -1 = none (--operator truncate)
+    bool slice = false;            // render the cross-section instead (--slice <offset>)
+    float sliceOffset = 0.0f;      // hyperplane offset as a fraction of the circumradius
+    bool faces = false;            // also fill the 2-faces (--faces <opacity>)
+    float faceOpacity = 0.3f;
+    int renderPath = 0;            // RenderPath, by name (--render-path oit)
+    bool glLines = false;          // glLineWidth edges instead of anti-aliased quads (--gl-lines)
+    bool glPoints = false;         // glPointSize vertices instead of disc sprites (--gl-points)
+    bool gallery = false;          // every object at once in a grid, family and dimension ignored (--gallery)
+    int instances = 0;             // draw this many copies of the object instead (--instances <count>)
+    bool cascade = false;          // every intermediate shadow in its own viewport (--cascade)
+    bool scatterMatrix = false;    // axis-pair scatterplot matrix of the vertices (--scatter-matrix)
+    std::string pointSetPath;      // --points and --zonotope, forwarded to the child shards
+    std::string zonotopePath;      // (parsePointSetArgs loads them)
+    std::string outputDir = "frames";
+
+    // Parallelism: frames are split into contiguous shards, one per process.
+    // jobs > 1 makes this process spawn shards 1..jobs-1 as child processes.
+    int shardIndex = 0;
+    int shardCount = 1;
+    int jobs = 1;
+    int writerThreads = 0;         // encoder/writer threads per process (0 = hardware concurrency)
+};
+
+// Renders one frame at the given scene time into the currently bound framebuffer
+typedef std::function<void(float sceneTime, int width, int height)> OfflineFrameRenderer;
+
+// Parse offline flags from the command line. Returns false (after printing why) on bad input.
+// Call before parsePointSetArgs, which takes --points and --zonotope out of argv.
+bool parseOfflineArgs(int argc, char** argv, OfflineRenderSettings& settings);
+
+// Render this process' shard of frames to <outputDir>/frame_NNNNNN.ppm.
+// Requires a current GL context. Returns the process exit code.
+int runOfflineRender(const OfflineRenderSettings& settings, const char* executablePath,
+                     const OfflineFrameRenderer& renderFrame);
+
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <functional>
+
+// Run body(i, worker) for every i in [0, count) on up to threadCount threads
+// (0 = hardware concurrency). Indices are handed out in small blocks on demand;
+// worker is in [0, threadCount) and identifies the thread, for per-thread scratch.
+// The calling thread takes part as worker 0.
+void parallelFor(int count, int threadCount, const std::function<void(int, int)>& body);
+
+// Threads parallelFor will use for a threadCount argument (resolves 0)
+int parallelThreadCount(int threadCount);
+
+#endif
@@ -0,0 +1,103 @@
+#pragma once
+#ifndef POLYTOPE_CACHE_H
+#define POLYTOPE_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "polytope_generators.h"
+
+// Binary polytope cache (.ndpc). Generated geometry is written once and later runs map the
+// file and hand the vertex table and edge indices straight to glBufferData, with no parsing.
+//
+// Layout (native little-endian, every section 16-byte aligned):
+//   PolytopeCacheHeader
+//   vertex table     vertexCount * dimensions float32
+//   edge indices     edgeCount * 2 uint32
+//   face lattice     latticeWords uint32 (serializeFaceLattice; 0 words when the mesh has no facets)
+// The checksum is FNV-1a 64 over the header up to the checksum field, so it covers the section
+// table but not the (possibly hundreds of MB of) section data. open() instead range-checks the
+// edge indices against vertexCount, and deserializeFaceLattice checks the lattice's indices.
+
+const char POLYTOPE_CACHE_MAGIC[4] = { 'N', 'D', 'P', 'C' };
+const uint32_t POLYTOPE_CACHE_VERSION = 2;
+const char* const POLYTOPE_CACHE_DIR = "cache";
+
+struct PolytopeCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t headerBytes;
+    uint32_t dimensions;
+    uint32_t vertexCount;
+    uint32_t edgeCount;
+    uint32_t latticeWords;
+    uint32_t reserved;
+    uint64_t paramsHash;                      // family, dimension and generator parameters
+    uint64_t vertexOffset;
+    uint64_t edgeOffset;
+    uint64_t latticeOffset;
+    uint64_t fileBytes;
+    uint64_t checksum;
+};
+
+// A loaded polytope: either a read-only mapping of a cache file, or (when the cache
+// can't be written) the generated mesh kept in memory. Pointers stay valid until destruction.
+class PolytopeCacheFile {
+public:
+    PolytopeCacheFile() = default;
+    ~PolytopeCacheFile();
+    PolytopeCacheFile(const PolytopeCacheFile&) = delete;
+    PolytopeCacheFile& operator=(const PolytopeCacheFile&) = delete;
+
+    // Map and validate a cache file. Fails (printing why) on a missing, truncated,
+    // mismatched or corrupt file, one whose sections are misaligned, or one with an
+    // edge index past the vertex table.
+    bool open(const std::string& path, uint64_t expectedParamsHash);
+    void adopt(PolytopeMesh&& mesh);
+
+    int dimensions() const { return header().dimensions; }
+    int vertexCount() const { return header().vertexCount; }
+    int edgeCount() const { return header().edgeCount; }
+    const float* vertices() const { return reinterpret_cast<const float*>(base + header().vertexOffset); }
+    size_t vertexBytes() const { return (size_t)vertexCount() * dimensions() * sizeof(float); }
+    const unsigned int* edges() const { return reinterpret_cast<const unsigned int*>(base + header().edgeOffset); }
+    const unsigned int* lattice() const { return reinterpret_cast<const unsigned int*>(base + header().latticeOffset); }
+    size_t latticeWords() const { return header().latticeWords; }
+    bool isMapped() const { return mapping != nullptr; }
+
+private:
+    const PolytopeCacheHeader& header() const { return *reinterpret_cast<const PolytopeCacheHeader*>(base); }
+    void close();
+
+    const unsigned char* base = nullptr;
+    size_t size = 0;
+    void* mapping = nullptr;                  // mapped view, nullptr for in-memory data
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+    std::vector<unsigned char> owned;         // serialized image when not mapped
+};
+
+uint64_t fnv1a64(const void* data, size_t bytes, uint64_t hash = 0xcbf29ce484222325ULL);
+
+// Key for a generator run, e.g. hashPolytopeParams("hypercube", 8, "v1")
+uint64_t hashPolytopeParams(const char* family, int dims, const std::string& params);
+
+// <dir>/<family>_<dims>D_<hash>.ndpc
+std::string polytopeCachePath(const std::string& dir, const char* family, int dims, uint64_t paramsHash);
+
+// Serialize a mesh into the cache layout
+void serializePolytope(const PolytopeMesh& mesh, uint64_t paramsHash, std::vector<unsigned char>& out);
+
+// Write via a temporary file and rename, so concurrent processes never see a partial file
+bool writePolytopeCache(const std::string& path, const PolytopeMesh& mesh, uint64_t paramsHash);
+
+// Map the cached polytope for (family, dims, params), generating and caching it first
+// if there is no valid file. A generated mesh with facets gets its face lattice built here.
+std::unique_ptr<PolytopeCacheFile> loadOrGeneratePolytope(const char* family, int dims, const std::string& params,
+                                                          const std::function<void(PolytopeMesh&)>& generate);
+
+#endif
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef POLYTOPE_GENERATORS_H
+#define POLYTOPE_GENERATORS_H
+
+#include <vector>
+
+// Indexed polytope geometry: a vertex table plus edges as index pairs
+struct PolytopeMesh {
+    int dimensions = 0;
+    std::vector<float> vertices;              // dimensions floats per vertex
+    std::vector<unsigned int> edges;          // two vertex indices per edge
+    std::vector<unsigned int> facetOffsets;   // facet -> vertices as CSR (empty if unknown)
+    std::vector<unsigned int> facetVertices;
+    std::vector<unsigned int> lattice;        // optional serialized face lattice (empty if not computed)
+
+    int vertexCount() const { return dimensions > 0 ? (int)(vertices.size() / dimensions) : 0; }
+    int edgeCount() const { return (int)(edges.size() / 2); }
+    int facetCount() const { return facetOffsets.empty() ? 0 : (int)facetOffsets.size() - 1; }
+};
+
+// N-cube with vertices at (+-1, ..., +-1); vertex i has coordinate j = +1 when bit j of i is set.
+// Facet 2j + s holds the vertices with bit j equal to s.
+void generateHypercube(int dims, PolytopeMesh& mesh);
+
+// Regular N-simplex, centered, edge length 2. Vertex i is basis vector e_i of R^(N+1)
+// expressed in the Helmert basis of the hyperplane orthogonal to (1, ..., 1).
+// Facet i holds every vertex except i.
+void generateSimplex(int dims, PolytopeMesh& mesh);
+
+// N-orthoplex with vertices +-e_i (2i = +e_i, 2i+1 = -e_i); every non-antipodal pair is an edge.
+// Facet m (one per orthant) holds vertex 2i + bit i of m for each i.
+void generateCrossPolytope(int dims, PolytopeMesh& mesh);
+
+// Regular polygon with the given number of sides on the unit circle; its facets are its edges
+void generatePolygon(int sides, PolytopeMesh& mesh);
+
+#endif
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef POLYTOPE_OPERATORS_H
+#define POLYTOPE_OPERATORS_H
+
+#include "polytope_generators.h"
+
+struct FaceLattice;
+
+// Operators that build new polytopes from generated ones, in indexed form.
+
+// Cartesian product A x B in dims(A) + dims(B) dimensions. Vertex (i, j) gets index
+// i * |B| + j and coordinates (a_i, b_j). Edges are (edge of A) x (vertex of B) and
+// (vertex of A) x (edge of B); facets are (facet of A) x B and A x (facet of B), emitted
+// only when both factors have facets. Everything is written straight into out.
+// Examples: polygon x polygon = duoprism, polygon x segment (generateHypercube(1)) = prism,
+// hypercube x hypercube = hypercube.
+void productPolytope(const PolytopeMesh& a, const PolytopeMesh& b, PolytopeMesh& out);
+
+// Where the dual puts the vertex standing for each primal facet
+enum DualPlacement {
+    DUAL_POLAR,      // pole of the facet hyperplane n.x = h about the vertex centroid: n / h
+    DUAL_CENTROID    // centroid of the facet's vertices
+};
+
+// Dual polytope from the primal vertices and face lattice: one vertex per facet (in facet
+// order), an edge for every ridge joining the two facets through it, and one facet per
+// primal vertex holding the facets around it. Linear in the size of the lattice; facet
+// planes are solved in parallel. The polar dual of a polytope centered at the origin
+// with circumradius 1 has inradius 1 (hypercube <-> cross-polytope exactly).
+// Returns false (printing why) when a facet is degenerate or the centroid is not inside.
+bool dualPolytope(const float* vertices, int dims, const FaceLattice& lattice, PolytopeMesh& out,
+                  DualPlacement placement = DUAL_POLAR, int threadCount = 0);
+
+// Wythoff-style operators, each ringing a set of face ranks of the input polytope
+enum PolytopeOperator {
+    OPERATOR_TRUNCATE,       // ranks {0, 1}: every vertex cut off
+    OPERATOR_RECTIFY,        // rank 1: vertices at the edge midpoints
+    OPERATOR_BITRUNCATE,     // ranks {1, 2}: truncation of the rectified polytope
+    OPERATOR_CANTELLATE,     // ranks {0, 2}: vertices and edges bevelled
+    OPERATOR_COUNT
+};
+
+// Lowercase name ("truncate", ...) and ringed ranks (bit k = rank k)
+const char* polytopeOperatorName(PolytopeOperator op);
+unsigned int polytopeOperatorRanks(PolytopeOperator op);
+
+// Ringed polytope from the input's vertices and face lattice. Each vertex is a chain of
+// faces, one of each ringed rank, each face inside the next. It sits at a weighted sum of
+// their centroids; the weights make every edge the same length when the input is regular.
+// Two chains are joined by an edge when they differ in one face, across a diamond of
+// the lattice (the two k-faces between one (k-1)-face and one (k+1)-face). The result
+// also gets the facets of the Wythoff construction, and keeps the input's circumradius.
+// Chains, vertices, edges and facet incidences are produced in parallel over faces, in
+// flat arrays. Returns false (printing why) for ranks the input does not have.
+bool ringedPolytope(const float* vertices, int dims, const FaceLattice& lattice, unsigned int rankMask,
+                    PolytopeMesh& out, int threadCount = 0);
+
+inline bool applyPolytopeOperator(PolytopeOperator op, const float* vertices, int dims, const FaceLattice& lattice,
+                                  PolytopeMesh& out, int threadCount = 0) {
+    return ringedPolytope(vertices, dims, lattice, polytopeOperatorRanks(op), out, threadCount);
+}
+
+// Whether a and b have the same vertices (within tolerance, in any order) and the same
+// edges between them; facets are not compared
+bool samePolytope(const PolytopeMesh& a, const PolytopeMesh& b, float tolerance);
+
+#endif
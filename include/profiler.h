@@ -0,0 +1,87 @@
+#pragma once
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+
+// Stages of the main loop, in the order they run
+enum ProfileStage {
+    PROFILE_IMGUI_BUILD,
+    PROFILE_ROTATION_BUILD,
+    PROFILE_SLICE,
+    PROFILE_FACE_SORT,
+    PROFILE_UNIFORM_UPLOAD,
+    PROFILE_DRAW,
+    PROFILE_IMGUI_RENDER,
+    PROFILE_SWAP,
+    PROFILE_STAGE_COUNT
+};
+
+// Per-stage CPU timings plus GPU timings from GL_TIME_ELAPSED queries.
+// Queries live in a ring of QUERY_RING_SIZE frames and are only read back once
+// GL reports them available, so profiling never stalls the pipeline.
+class FrameProfiler {
+public:
+    static const int QUERY_RING_SIZE = 4;
+    static const int HISTORY_SIZE = 240;      // frames kept for the histogram and percentiles
+    static const int HISTOGRAM_BINS = 40;
+
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    void beginFrame();
+    void endFrame();
+    void beginStage(ProfileStage stage);
+    void endStage(ProfileStage stage);
+
+    // Draw the profiler section into the current ImGui window
+    void drawImGui();
+
+    float percentile(float p) const;          // frame time in ms, p in [0, 1]
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    void collectGpuResults(int slot);
+
+    bool initialized = false;
+    bool inFrame = false;
+    bool stageOpen = false;                   // GL_TIME_ELAPSED queries can't nest
+    long long frameIndex = 0;
+    int slot = 0;
+
+    unsigned int queries[QUERY_RING_SIZE][PROFILE_STAGE_COUNT] = {};
+    bool queryIssued[QUERY_RING_SIZE][PROFILE_STAGE_COUNT] = {};
+
+    Clock::time_point frameStart;
+    Clock::time_point stageStart[PROFILE_STAGE_COUNT];
+    bool hasPreviousFrame = false;
+
+    // smoothed per-stage timings in milliseconds
+    float cpuStageMs[PROFILE_STAGE_COUNT] = {};
+    float gpuStageMs[PROFILE_STAGE_COUNT] = {};
+
+    // rolling frame-time history (ms)
+    float frameTimes[HISTORY_SIZE] = {};
+    int historyCount = 0;
+    int historyHead = 0;
+};
+
+// Scoped zone: times a stage for as long as it is alive
+class ProfileZone {
+public:
+    ProfileZone(FrameProfiler& profiler, ProfileStage stage) : profiler(profiler), stage(stage) {
+        profiler.beginStage(stage);
+    }
+    ~ProfileZone() {
+        profiler.endStage(stage);
+    }
+
+private:
+    FrameProfiler& profiler;
+    ProfileStage stage;
+};
+
+extern FrameProfiler profiler;
+
+#endif
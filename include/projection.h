@@ -0,0 +1,70 @@
+#pragma once
+#ifndef PROJECTION_H
+#define PROJECTION_H
+
+// CPU mirror of the vertex shaders (shaders/<N>d.v): N-D rotation followed by the
+// chain of perspective projections down to 3D world space. Used wherever the CPU
+// needs to know where a vertex ends up (benchmarks, slicing, depth sorting, ...).
+
+// Largest dimension the CPU path handles
+const int MAX_PROJECTION_DIMENSIONS = 32;
+
+// Distance of the projection "camera" from the origin at every N -> N-1 step (same in all shaders)
+const float PROJECTION_DISTANCE = 3.0f;
+
+// out = rotation * in, rotation is row-major dims x dims
+inline void rotateVertex(const float* rotation, int dims, const float* in, float* out) {
+    for (int i = 0; i < dims; i++) {
+        float sum = 0.0f;
+        const float* row = rotation + i * dims;
+        for (int j = 0; j < dims; j++) {
+            sum += row[j] * in[j];
+        }
+        out[i] = sum;
+    }
+}
+
+// Project an already rotated vertex to 3D world space (scale applied, like the shaders).
+// Returns false when the final 4D -> 3D step would clip the vertex.
+inline bool projectToWorld(const float* rotated, int dims, float scale, float* world) {
+    if (dims <= 3) {
+        world[0] = rotated[0] * scale;
+        world[1] = dims > 1 ? rotated[1] * scale : 0.0f;
+        world[2] = dims > 2 ? rotated[2] * scale : 0.0f;
+        return true;
+    }
+
+    // Each N -> N-1 step divides all remaining coordinates by the same divisor, so the
+    // chain down to 4D collapses into one running factor (O(N) instead of O(N^2))
+    float factor = 1.0f;
+    for (int d = dims; d > 4; d--) {
+        factor /= PROJECTION_DISTANCE + rotated[d - 1] * factor;
+    }
+
+    // 4D -> 3D with the same clip guard as the shaders
+    float divisor = PROJECTION_DISTANCE + rotated[3] * factor;
+    if (divisor < 0.001f) {
+        return false;
+    }
+    factor *= scale / divisor;
+    world[0] = rotated[0] * factor;
+    world[1] = rotated[1] * factor;
+    world[2] = rotated[2] * factor;
+    return true;
+}
+
+// Rotate and project a batch of vertices (dims floats each) to world space (3 floats each).
+// Clipped vertices are written as the origin, matching gl_Position = vec4(0).
+inline void transformVertices(const float* rotation, int dims, float scale,
+                              const float* vertices, int count, float* worldOut) {
+    float rotated[MAX_PROJECTION_DIMENSIONS];
+    for (int v = 0; v < count; v++) {
+        rotateVertex(rotation, dims, vertices + v * dims, rotated);
+        float* world = worldOut + v * 3;
+        if (!projectToWorld(rotated, dims, scale, world)) {
+            world[0] = world[1] = world[2] = 0.0f;
+        }
+    }
+}
+
+#endif
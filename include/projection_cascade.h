@@ -0,0 +1,28 @@
+#pragma once
+#ifndef PROJECTION_CASCADE_H
+#define PROJECTION_CASCADE_H
+
+#include <vector>
+#include <glm/glm.hpp>
+#include "ndim_object.h"
+
+// Every intermediate shadow of the N -> 3 projection chain side by side: the (N-1)-D shadow,
+// the (N-2)-D one, ... down to the usual 3D one, each shown by its first three coordinates.
+// Every viewport draws the object's own vertex buffer with shaders/cascade.v, stopped at its
+// stage by a uniform, so the geometry is uploaded once and the cost grows linearly with the
+// number of stages.
+struct CascadeViewport {
+    int x, y, width, height;                  // pixels, origin bottom left
+    int stage;                                // dimensions of the shadow shown
+};
+
+// Stages N-1 down to 3 (none below 4D), left to right and top to bottom in a grid of
+// near-square cells filling the target
+std::vector<CascadeViewport> cascadeViewports(int dimensions, int width, int height);
+
+// Draw the cascade of the object. The cascade shader (renderPathCascadeShader) must be in use
+// with rotationMat, scale and view set; the projection is rebuilt per viewport for its aspect.
+// The viewport is left at the full width x height target.
+void drawProjectionCascade(const NDimObjectData& object, Shader& shader, float fovy, int width, int height);
+
+#endif
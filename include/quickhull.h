@@ -0,0 +1,28 @@
+#pragma once
+#ifndef QUICKHULL_H
+#define QUICKHULL_H
+
+#include <string>
+#include <vector>
+#include "polytope_generators.h"
+
+// Convex hulls of arbitrary N-D point sets (Quickhull). The hull is grown from an initial
+// simplex by repeatedly taking the furthest point above some facet, removing every facet
+// it can see and coning the horizon to it. Each facet keeps a conflict list of the points
+// above it. Facets live in a slot arena recycled through a free list; outside points are
+// assigned to facets in parallel.
+
+// Random points uniformly distributed on the unit sphere S^(dims-1)
+void generateSpherePoints(int dims, int count, unsigned int seed, std::vector<float>& points);
+
+// Read a point set: one point per line, whitespace-separated coordinates, '#' comments.
+// Every point must have the same number of coordinates (returned in dims).
+bool loadPointSet(const std::string& path, int& dims, std::vector<float>& points);
+
+// Hull of pointCount points (dims floats each) as an indexed polytope: the extreme points
+// (in input order), the true facets (coplanar simplices merged) and the edges.
+// Points within a relative tolerance of a facet's hyperplane count as inside it.
+// Returns false (printing why) when the points do not span all dims dimensions.
+bool computeConvexHull(const float* points, int pointCount, int dims, PolytopeMesh& mesh, int threadCount = 0);
+
+#endif
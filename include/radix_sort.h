@@ -0,0 +1,31 @@
+#pragma once
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <cstdint>
+#include <vector>
+
+// Map a float to a uint32 whose unsigned order is the float's order (-0 sorts below +0, NaNs last)
+inline uint32_t floatSortKey(float value) {
+    union {
+        float f;
+        uint32_t u;
+    } bits;
+    bits.f = value;
+    return bits.u ^ ((bits.u & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u);
+}
+
+// Reusable buffers for radixSortPairs, so per-frame sorts don't allocate
+struct RadixSortScratch {
+    std::vector<uint32_t> keys;
+    std::vector<uint32_t> values;
+    std::vector<uint32_t> counts;            // per chunk: one count (then offset) per digit
+};
+
+// Stable ascending sort of keys, carrying values along: LSD radix sort, 8 bits per pass, and
+// passes on which every key has the same digit are skipped. The input is split into fixed-size
+// chunks that histogram and scatter independently (in parallel on up to threadCount threads,
+// 0 = hardware concurrency), so short inputs stay on the calling thread.
+void radixSortPairs(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, RadixSortScratch& scratch, int threadCount = 0);
+
+#endif
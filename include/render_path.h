@@ -0,0 +1,75 @@
+#pragma once
+#ifndef RENDER_PATH_H
+#define RENDER_PATH_H
+
+#include "ndim_object.h"
+
+// How an object's fragments become pixels. The opaque paths only swap the fragment shader
+// paired with the object's vertex shader. The transparent paths accumulate every fragment
+// into offscreen float targets, in any order, and resolve them over the scene with a single
+// full-screen pass, so the extra cost does not grow with the edge count.
+enum RenderPath {
+    RENDER_PATH_POSITION,       // shaders/ws-coloring.f (every object's own shader)
+    RENDER_PATH_HEIGHT,         // shaders/color-from-height.f
+    RENDER_PATH_OIT,            // weighted blended order-independent transparency
+    RENDER_PATH_DENSITY,        // additive coverage, tone mapped by an exposure
+    RENDER_PATH_COUNT
+};
+
+// Short name, as accepted by --render-path
+const char* renderPathName(RenderPath path);
+inline bool renderPathTransparent(RenderPath path) { return path == RENDER_PATH_OIT || path == RENDER_PATH_DENSITY; }
+
+// The object's vertex shader paired with the path's fragment shader. Variants are compiled
+// on first use and shared by every object with the same vertex shader; the transparent
+// ones take an "alpha" uniform (set it before drawing).
+Shader* renderPathShader(const NDimObjectData& object, RenderPath path);
+
+// shaders/thick-lines.v (any dimension, see ThickLines) and shaders/vertex-sprites.v (see
+// VertexSprites) with shaders/coverage.f, which turns the analytic coverage into alpha on the
+// opaque paths and scales the accumulated alpha by it on the transparent ones
+Shader* renderPathLineShader(RenderPath path);
+Shader* renderPathSpriteShader(RenderPath path);
+
+// shaders/gallery.v (every object of the grid at once, see Gallery) with the path's fragment shader
+Shader* renderPathGalleryShader(RenderPath path);
+
+// shaders/instanced.v (copies of one object, see InstancedObjects) with the path's fragment shader
+Shader* renderPathInstancedShader(RenderPath path);
+
+// shaders/cascade.v (the projection chain stopped at a stage, see projection_cascade.h) with the
+// path's fragment shader
+Shader* renderPathCascadeShader(RenderPath path);
+
+// shaders/scatter-matrix.v (axis-pair panels, see scatter_matrix.h) with the path's fragment shader
+Shader* renderPathScatterMatrixShader(RenderPath path);
+void cleanupRenderPathShaders();
+
+// Accumulation targets and composite pass of the transparent paths
+class TransparencyTargets {
+public:
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    // Send drawing to the accumulation targets (sized to width x height, reallocated when that
+    // changes) with the path's blending, no depth test and no depth writes. The framebuffer
+    // bound until now is remembered for resolve.
+    void begin(RenderPath path, int width, int height);
+
+    // Composite the accumulated fragments over the remembered framebuffer and restore the
+    // default state (blending off, depth test and writes on). exposure scales the density path.
+    void resolve(float exposure);
+
+private:
+    Shader* composite = nullptr;
+    unsigned int VAO = 0;                     // empty: the full-screen triangle comes from gl_VertexID
+    unsigned int FBO = 0;
+    unsigned int accumulationTexture = 0;     // RGBA16F: weighted color sum, revealage in alpha
+    unsigned int weightTexture = 0;           // R16F: weight sum
+    int width = 0;
+    int height = 0;
+    int target = 0;                           // framebuffer to resolve into
+    RenderPath path = RENDER_PATH_OIT;
+};
+
+#endif
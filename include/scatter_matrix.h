@@ -0,0 +1,17 @@
+#pragma once
+#ifndef SCATTER_MATRIX_H
+#define SCATTER_MATRIX_H
+
+#include "ndim_object.h"
+
+// Scatterplot matrix of the rotated vertices: one panel per axis pair (i, j), i < j, in the
+// upper triangle of an (N-1) x (N-1) grid, showing the orthogonal projection onto axis j
+// (across) and axis i (up). 28 panels for 8D, all drawn from the object's own vertex buffer
+// by one instanced draw with shaders/scatter-matrix.v, the instance selecting the pair.
+inline int scatterMatrixPanels(int dimensions) { return dimensions * (dimensions - 1) / 2; }
+
+// Draw the matrix into a square grid centered in the width x height target. The scatter
+// matrix shader (renderPathScatterMatrixShader) must be in use with rotationMat set.
+void drawScatterMatrix(const NDimObjectData& object, Shader& shader, int width, int height);
+
+#endif
@@ -102,6 +102,11 @@ public:
 
     }
 
+    void setVec2(const std::string& name, float x, float y) const
+    {
+        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+    }
+
     void setVec3(const std::string& name, float x, float y, float z) const
     {
         // Uses glUniform3f, which takes the uniform location followed by 
@@ -0,0 +1,93 @@
+#pragma once
+#ifndef STREAMED_HYPERCUBE_H
+#define STREAMED_HYPERCUBE_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <glm/glm.hpp>
+#include "ndim_object.h"
+
+// Hypercubes too large to store: a 20-cube has 2^20 vertices and 10.5M edges, which as a
+// GL_LINES list would be gigabytes. Instead edges are enumerated by bit flips in
+// fixed-size chunks, rotated and projected to 3D on worker threads, and streamed
+// through a small ring of GPU buffers, each chunk drawn as soon as it arrives.
+// Memory use is the same for every N.
+
+const int STREAM_MIN_DIMENSIONS = 4;
+const int STREAM_MAX_DIMENSIONS = 24;
+const int STREAM_CHUNK_EDGES = 1 << 16;       // upper bound on edges per chunk
+const int STREAM_RING_SIZE = 4;               // GPU buffers in flight
+
+// Per-frame input to the generator, shared read-only by all workers
+struct HypercubeStreamFrame {
+    int dimensions;
+    float halfEdge;                           // vertices are (+-halfEdge, ..., +-halfEdge)
+    float scale;
+    float columns[STREAM_MAX_DIMENSIONS * STREAM_MAX_DIMENSIONS];   // rotation matrix, column-major
+};
+
+// Fill frame for the given row-major rotation matrix
+void prepareStreamFrame(HypercubeStreamFrame& frame, int dimensions, const float* rotation, float scale);
+
+// Vertices visited in a chunk (the chunk holds at most STREAM_CHUNK_EDGES edges)
+int streamVerticesPerChunk(int dimensions);
+
+// Write the world-space endpoints (6 floats per edge) of the edges from each vertex to
+// its neighbours with one more bit set, for vertices [firstVertex, firstVertex + vertexCount)
+// in Gray-code order. Each edge of the cube comes from exactly one vertex. Returns the edge count.
+int generateHypercubeChunk(const HypercubeStreamFrame& frame, long long firstVertex, int vertexCount, float* out);
+
+class StreamedHypercube {
+public:
+    void init(int dimensions);                // needs a current GL context
+    void cleanup();
+    void setDimensions(int dimensions);
+
+    // Rotate at scene time and draw every edge with the given camera, using the given
+    // program built on shaders/3d.v instead of the object's own when there is one
+    void draw(float sceneTime, const glm::mat4& view, const glm::mat4& projection, Shader* shader = nullptr);
+
+    int dimensions() const { return object.dimensions; }
+    long long edgeCount() const;
+    int chunkCount() const;
+    const NDimObjectData& data() const { return object; }
+
+private:
+    struct StagingSlot {
+        std::vector<float> vertices;
+        long long chunk = -1;                 // chunk held, -1 when free
+        bool ready = false;
+        int edges = 0;
+    };
+
+    void startWorkers();
+    void stopWorkers();
+    void workerLoop();
+    void uploadAndDraw(const StagingSlot& slot);
+
+    // Rotation planes, identity and shader; vertices stay empty
+    NDimObjectData object = NDimObjectData();
+    std::vector<RotationPlane> planes;
+    std::vector<float> identity;
+    std::vector<float> rotation;
+    HypercubeStreamFrame frame;
+
+    // GPU ring
+    unsigned int ringVAO[STREAM_RING_SIZE] = {};
+    unsigned int ringVBO[STREAM_RING_SIZE] = {};
+    GLsync ringFence[STREAM_RING_SIZE] = {};
+    int ringNext = 0;
+
+    // Worker pipeline: chunk c is generated into slots[c % slots.size()]
+    std::vector<std::thread> workers;
+    std::vector<StagingSlot> slots;
+    std::mutex mutex;
+    std::condition_variable changed;
+    long long nextChunk = 0;
+    long long frameChunks = 0;
+    bool stopping = false;
+};
+
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef THICK_LINES_H
+#define THICK_LINES_H
+
+#include "ndim_object.h"
+
+// Edges of any width, with anti-aliasing, without glLineWidth (core profile drivers may clamp
+// it to 1px). Vertices go in a buffer texture and edges in an instanced attribute; every edge
+// instance is a 4-corner triangle strip that shaders/thick-lines.v rotates and projects like the
+// object's own shader, then expands to a screen-aligned quad around the two projected endpoints.
+// shaders/coverage.f gets each pixel's distance from the edge's center line for its coverage.
+// One draw call per object.
+class ThickLines {
+public:
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    // Draw this object's edges from now on (nothing to upload when it is already the current one)
+    void setObject(const NDimObjectData& object);
+
+    // Upload changing geometry, e.g. a cross-section: dims floats per vertex, edges as index pairs
+    void setGeometry(const float* vertices, int vertexCount, int dims, const unsigned int* edges, int edgeCount);
+
+    // Draw the edges EDGE_THICKNESS pixels wide. The line shader (renderPathLineShader) must be in use with
+    // the rotation, scale and camera uniforms set. With blend false the caller's blending (a
+    // transparent render path) is left alone, otherwise coverage is blended over the scene.
+    void draw(Shader& shader, bool blend = true);
+
+    int edgeCount() const { return edges; }
+
+private:
+    const NDimObjectData* object = nullptr;
+    unsigned int objectGeneration = 0;       // detects the object's geometry being reloaded
+    int dims = 0;
+    int edges = 0;
+
+    // GL
+    unsigned int VAO = 0;
+    unsigned int edgeBuffer = 0;              // instanced uvec2 per edge
+    unsigned int vertexBuffer = 0;            // backs vertexTexture
+    unsigned int vertexTexture = 0;           // GL_R32F buffer texture
+};
+
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <chrono>
+#include <string>
+
+// Timeline tracing in Chrome trace-event format (chrome://tracing, ui.perfetto.dev).
+// Every thread records into its own fixed-size ring, so recording is a couple of
+// stores and one atomic increment with no locks; the oldest events are overwritten.
+// A dump copies whatever the rings currently hold into a JSON file.
+
+// Events kept per thread before the oldest are overwritten (~6 s of main loop zones at 144 fps)
+const int TRACE_RING_CAPACITY = 1 << 13;
+
+// Microseconds since the process started tracing
+long long traceTimestampUs();
+long long traceTimestampUs(std::chrono::steady_clock::time_point time);
+
+// Record a complete ("X") event. name and category must be string literals or otherwise outlive the dump.
+void traceComplete(const char* name, const char* category, long long startUs, long long durationUs);
+// Record an instant ("i") event, e.g. a user action
+void traceInstant(const char* name, const char* category);
+// Name the calling thread in the exported timeline
+void traceSetThreadName(const char* name);
+
+// Write all buffered events as Chrome trace-event JSON. Returns false if the file can't be written.
+bool writeChromeTrace(const std::string& path);
+
+// Consume "--trace <path>" from argv (so other parsers never see it). Returns the path or "".
+std::string parseTraceArgs(int& argc, char** argv);
+
+// Scoped complete event
+class TraceScope {
+public:
+    TraceScope(const char* name, const char* category = "app") : name(name), category(category), startUs(traceTimestampUs()) {}
+    ~TraceScope() {
+        traceComplete(name, category, startUs, traceTimestampUs() - startUs);
+    }
+
+private:
+    const char* name;
+    const char* category;
+    long long startUs;
+};
+
+#endif
@@ -1,67 +0,0 @@
-#pragma once
-#include <cstddef>
-
-// We also provide the size of the array in bytes, since sizeof() won't work on an extern array.
-
-extern float hypercubeVerts_2D[];
-extern const size_t hypercubeVerts_2D_size;
-
-extern float simplexVerts_2D[];
-extern const size_t simplexVerts_2D_size;
-
-extern float hypercubeVerts_3D[];
-extern const size_t hypercubeVerts_3D_size;
-
-extern float hypercubeVerts_4D[];
-extern const size_t hypercubeVerts_4D_size;
-
-extern float hypercubeVerts_5D[];
-extern const size_t hypercubeVerts_5D_size;
-
-extern float hypercubeVerts_6D[];
-extern const size_t hypercubeVerts_6D_size;
-
-extern float hypercubeVerts_7D[];
-extern const size_t hypercubeVerts_7D_size;
-
-extern float hypercubeVerts_8D[];
-extern const size_t hypercubeVerts_8D_size;
-
-extern float crossPolytopeVerts_2D[];
-extern const size_t crossPolytopeVerts_2D_size;
-
-extern float crossPolytopeVerts_3D[];
-extern const size_t crossPolytopeVerts_3D_size;
-
-extern float crossPolytopeVerts_4D[];
-extern const size_t crossPolytopeVerts_4D_size;
-
-extern float crossPolytopeVerts_5D[];
-extern const size_t crossPolytopeVerts_5D_size;
-
-extern float crossPolytopeVerts_6D[];
-extern const size_t crossPolytopeVerts_6D_size;
-
-extern float crossPolytopeVerts_7D[];
-extern const size_t crossPolytopeVerts_7D_size;
-
-extern float crossPolytopeVerts_8D[];
-extern const size_t crossPolytopeVerts_8D_size;
-
-extern float simplexVerts_3D[];
-extern const size_t simplexVerts_3D_size;
-
-extern float simplexVerts_4D[];
-extern const size_t simplexVerts_4D_size;
-
-extern float simplexVerts_5D[];
-extern const size_t simplexVerts_5D_size;
-
-extern float simplexVerts_6D[];
-extern const size_t simplexVerts_6D_size;
-
-extern float simplexVerts_7D[];
-extern const size_t simplexVerts_7D_size;
-
-extern float simplexVerts_8D[];
-extern const size_t simplexVerts_8D_size;
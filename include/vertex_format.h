@@ -0,0 +1,35 @@
+#pragma once
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include <vector>
+#include <glad/glad.h>
+
+// How an object's N-D coordinates are stored in its vertex buffer.
+// Snorm formats store coordinate / positionScale, and GL maps them back to [-1, 1];
+// the vertex shaders multiply by the positionScale uniform before rotating.
+enum VertexFormat {
+    VERTEX_FORMAT_FLOAT32,
+    VERTEX_FORMAT_HALF,                       // 16-bit float, positionScale 1
+    VERTEX_FORMAT_SNORM16,
+    VERTEX_FORMAT_SNORM8,
+    VERTEX_FORMAT_COUNT
+};
+
+const char* vertexFormatName(VertexFormat format);
+int vertexFormatComponentBytes(VertexFormat format);
+GLenum vertexFormatGLType(VertexFormat format);
+GLboolean vertexFormatNormalized(VertexFormat format);
+
+// Bytes per vertex, padded to 4 so every attribute stays aligned
+int vertexFormatStride(VertexFormat format, int dims);
+
+// Encode `count` vertices of `dims` floats. Returns the factor the shader must
+// multiply decoded values by (the largest absolute coordinate for snorm formats).
+float encodeVertices(VertexFormat format, const float* vertices, int count, int dims,
+                     std::vector<unsigned char>& out);
+
+unsigned short floatToHalf(float value);
+float halfToFloat(unsigned short half);
+
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+#ifndef VERTEX_SPRITES_H
+#define VERTEX_SPRITES_H
+
+#include "ndim_object.h"
+
+// Vertices as anti-aliased discs of any size, without glPointSize (drivers clamp it). One
+// instance per unique vertex: shaders/vertex-sprites.v fetches the vertex from a buffer
+// texture by instance id, projects it like the object's own shader and expands a
+// screen-aligned square around it, and shaders/coverage.f shades the disc inside.
+// One draw call per object.
+class VertexSprites {
+public:
+    void init();                              // needs a current GL context
+    void cleanup();
+
+    // Draw this object's vertices from now on (nothing to upload when it is already the current one)
+    void setObject(const NDimObjectData& object);
+
+    // Upload changing geometry, e.g. a cross-section: dims floats per vertex
+    void setGeometry(const float* vertices, int vertexCount, int dims);
+
+    // Draw the vertices VERTEX_SIZE pixels across. The sprite shader (renderPathSpriteShader) must
+    // be in use with the rotation, scale and camera uniforms set. With blend false the caller's
+    // blending (a transparent render path) is left alone, otherwise coverage is blended over the scene.
+    void draw(Shader& shader, bool blend = true);
+
+    int vertexCount() const { return count; }
+
+private:
+    const NDimObjectData* object = nullptr;
+    unsigned int objectGeneration = 0;       // detects the object's geometry being reloaded
+    int dims = 0;
+    int count = 0;
+
+    // GL
+    unsigned int VAO = 0;                     // empty: everything comes from the buffer texture
+    unsigned int vertexBuffer = 0;            // backs vertexTexture
+    unsigned int vertexTexture = 0;           // GL_R32F buffer texture
+};
+
+#endif
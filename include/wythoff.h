@@ -0,0 +1,36 @@
+#pragma once
+#ifndef WYTHOFF_H
+#define WYTHOFF_H
+
+#include <string>
+#include "polytope_generators.h"
+
+// Uniform polytopes by Wythoff's construction: a finite reflection (Coxeter) group acts
+// on one seed point, and the orbit of that point is the vertex set. The seed lies on the
+// mirrors of the unringed nodes and equally far from the mirrors of the ringed ones, so
+// every edge is the image of a seed edge {p, R_i p} for a ringed node i, all of one length.
+
+const int WYTHOFF_MAX_RANK = 8;
+const int WYTHOFF_MAX_VERTICES = 1 << 20;
+
+// Coxeter matrix: order[i][j] is m_ij for the pair of mirrors i, j (2 = not joined in the diagram)
+struct CoxeterDiagram {
+    int rank = 0;
+    int order[WYTHOFF_MAX_RANK][WYTHOFF_MAX_RANK];
+};
+
+// Diagram from a spec:
+//   "5 3 3"     linear diagram with the given branch labels (rank = labels + 1)
+//   "E6" "E7" "E8", "D4".."D8", "A1".."A8", "B2".."B8", "F4", "H3", "H4"
+// Nodes are numbered along the diagram (B_n and H_n start at the end labelled 4 or 5). For E_n,
+// nodes 0..n-2 form a chain and node n-1 hangs off node n-4, so node 0 is the tip of the
+// longest arm; for D_n the fork is nodes n-2 and n-1, both joined to node n-3.
+bool parseCoxeterDiagram(const std::string& spec, CoxeterDiagram& diagram);
+
+// Vertices and edges of the uniform polytope with the given ringed nodes
+// (rings[i] == 'x' or '1' marks node i), normalized to circumradius 1. Orbits are
+// expanded breadth first, a frontier at a time in parallel, with hashed deduplication.
+// Returns false (printing why) for a bad diagram or ring pattern, or an infinite group.
+bool generateWythoff(const CoxeterDiagram& diagram, const std::string& rings, PolytopeMesh& mesh, int threadCount = 0);
+
+#endif
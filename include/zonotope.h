@@ -0,0 +1,28 @@
+#pragma once
+#ifndef ZONOTOPE_H
+#define ZONOTOPE_H
+
+#include <vector>
+#include "polytope_generators.h"
+
+// Zonotopes: Minkowski sums of segments [-g, g] (the N-cube is the sum of the unit axes).
+// A vertex is the sum of its generators weighted by a sign vector, one per region of the
+// central arrangement of the hyperplanes orthogonal to the generators; edges parallel to g
+// come from the regions of that arrangement restricted to g's hyperplane. Regions are built
+// for every flat (intersection of the hyperplanes) from the flats one dimension lower, so no
+// sign vector is ever tested for feasibility. The flats of one dimension are processed in parallel.
+
+// Sign vectors are bit masks, so at most this many (non-zero) generators
+const int ZONOTOPE_MAX_GENERATORS = 64;
+
+// count generators evenly spaced along the trigonometric moment curve
+// (cos t, sin t, cos 2t, sin 2t, ...), t in [0, pi); in 2D their zonotope is the regular 2count-gon
+void generateCyclicGenerators(int count, int dims, std::vector<float>& generators);
+
+// Zonotope of generatorCount generators (dims floats each) as an indexed polytope: vertices and
+// edges, no facets. Zero generators are ignored and parallel ones add up to a longer edge;
+// generators that do not span all dims give a flat zonotope. Returns false (printing why)
+// when there are no non-zero generators or more than ZONOTOPE_MAX_GENERATORS.
+bool generateZonotope(const float* generators, int generatorCount, int dims, PolytopeMesh& mesh, int threadCount = 0);
+
+#endif
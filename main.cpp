@@ -1,5 +1,6 @@
 #include <iostream>
 #include <map>
+#include <string>
 #include <utility>
 
 #include <glad/glad.h>
@@ -19,23 +20,40 @@
 #include "model.h"
 #include "shader_s.h"
 #include "filesystem.h"
-#include "vertex_data.h"
 #include "ndim_object.h"
 #include "hypercube_objects.h"
+#include "frame_state.h"
+#include "offline_render.h"
+#include "profiler.h"
+#include "trace.h"
+#include "streamed_hypercube.h"
+#include "cross_section.h"
+#include "filled_faces.h"
+#include "render_path.h"
+#include "thick_lines.h"
+#include "vertex_sprites.h"
+#include "gallery.h"
+#include "instanced_objects.h"
+#include "projection_cascade.h"
+#include "scatter_matrix.h"
+#include "face_lattice.h"
+#include "zonotope.h"
 
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
 void setImGuiElements();
 void initializeObjects();
 void cleanUpObjects();
 void updateCurrentObject();
+void renderScene(const FrameState& state, int width, int height);
 
 // settings
 unsigned int SCR_WIDTH = 1280;
 unsigned int SCR_HEIGHT = 720;
 
-const unsigned int IMGUI_WINDOW_WIDTH = 180;
+const unsigned int IMGUI_WINDOW_WIDTH = 220;
 const unsigned int IMGUI_WINDOW_HEIGHT = 500;
 
 // camera
@@ -61,21 +79,78 @@ int frameCount = 0;
 double lastFPSTime = 0.0;
 double currentFPS = 0.0;
 
+// tracing: F9 dumps the buffered timeline; --trace <path> also dumps on exit
+std::string tracePath;
+const char* DEFAULT_TRACE_PATH = "trace.json";
+
 // object
 NDimObjectData* currentObject;
 int shapesIndex = 0;
 int currentDimensionIndex = 2;  // Dropdown index (0-6 maps to dimensions 2-8)
+bool showDual = false;          // draw the polar dual of the selected object
+int operatorIndex = 0;          // 0 = none, else PolytopeOperator + 1, applied before the dual
 // Map to store objects by (shapeType, dimension) key
-std::map<std::pair<int, int>, NDimObjectData*> objectMap;
+ObjectMap objectMap;
+// hypercubes beyond 8D are generated and streamed every frame instead of stored
+StreamedHypercube streamedHypercube;
+bool streamHypercube = false;
+int streamDimensions = 12;
+// cross-section by the hyperplane orthogonal to the rotated last axis, recomputed every frame
+CrossSection crossSection;
+bool showCrossSection = false;
+float sliceOffset = 0.0f;       // fraction of the object's circumradius
+// semi-transparent 2-faces, depth sorted every frame
+FilledFaces filledFaces;
+bool showFaces = false;
+float faceOpacity = 0.3f;
+// fragment shading: an opaque coloring, or transparency accumulated offscreen (render_path.h)
+int renderPathIndex = RENDER_PATH_POSITION;
+TransparencyTargets transparencyTargets;
+float edgeAlpha = 0.15f;        // per-fragment coverage on the transparent paths
+float densityExposure = 0.5f;
+// edges as instanced anti-aliased quads (thick_lines.h) instead of glLineWidth lines
+bool thickEdges = true;
+ThickLines objectLines;
+ThickLines sectionLines;
+// vertices as instanced anti-aliased discs (vertex_sprites.h) instead of glPointSize points
+bool spriteVertices = true;
+VertexSprites objectSprites;
+VertexSprites sectionSprites;
+// every object of objectMap at once, in a grid drawn with two multi-draw calls (gallery.h)
+Gallery gallery;
+bool showGallery = false;
+// load test: thousands of copies of the current object, each rotated in the shader (instanced_objects.h)
+InstancedObjects instancedObjects;
+bool stressInstances = false;
+int stressInstanceCount = 4096;
+// the N-1, N-2, ... 3D shadows of the projection chain side by side (projection_cascade.h)
+bool showCascade = false;
+// one panel per axis pair, all in a single instanced draw (scatter_matrix.h)
+bool showScatterMatrix = false;
+
+
+int main(int argc, char** argv)
+{
+    traceSetThreadName("Main");
+    tracePath = parseTraceArgs(argc, argv);
 
+    OfflineRenderSettings offline;
+    if (!parseOfflineArgs(argc, argv, offline))
+    {
+        return -1;
+    }
+    parsePointSetArgs(argc, argv);
 
-int main()
-{
 #pragma region setup
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    if (offline.enabled)
+    {
+        // offline frames go to an offscreen framebuffer; the window only provides the context
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
 
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Higher Dimensions", NULL, NULL);
     if (window == NULL)
@@ -87,6 +162,7 @@ int main()
     glfwMakeContextCurrent(window);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
     glfwSetScrollCallback(window, scroll_callback);
+    glfwSetKeyCallback(window, key_callback);
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
     {
         std::cout << "Failed to initialize GLAD" << std::endl;
@@ -106,14 +182,59 @@ int main()
 
     initializeObjects();
     currentObject = &hypercube4D;
+    profiler.init();
+
+    if (offline.enabled)
+    {
+        shapesIndex = offline.family;
+        renderPathIndex = offline.renderPath;
+        thickEdges = !offline.glLines;
+        spriteVertices = !offline.glPoints;
+        showGallery = offline.gallery;
+        stressInstances = offline.instances > 0;
+        stressInstanceCount = offline.instances;
+        showCascade = offline.cascade;
+        showScatterMatrix = offline.scatterMatrix;
+        if (offline.family == 0 && offline.dimension > 8)
+        {
+            streamHypercube = true;
+            streamDimensions = offline.dimension;
+            streamedHypercube.setDimensions(streamDimensions);
+        }
+        else
+        {
+            currentDimensionIndex = offline.dimension - 2;
+            showDual = offline.dual;
+            operatorIndex = offline.polytopeOperator + 1;
+            showCrossSection = offline.slice;
+            sliceOffset = offline.sliceOffset;
+            showFaces = offline.faces;
+            faceOpacity = offline.faceOpacity;
+            updateCurrentObject();
+        }
+
+        int result = runOfflineRender(offline, argv[0], [](float sceneTime, int width, int height) {
+            FrameState state = computeFrameState(*currentObject, sceneTime, rotationRate, camRotRadius, camera.Position.y);
+            renderScene(state, width, height);
+        });
+
+        if (!tracePath.empty())
+        {
+            writeChromeTrace(tracePath);
+        }
+        profiler.cleanup();
+        cleanUpObjects();
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui_ImplGlfw_Shutdown();
+        ImGui::DestroyContext();
+        glfwTerminate();
+        return result;
+    }
 
     // render loop
     // -----------
     while (!glfwWindowShouldClose(window))
     {
-        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
         float currentFrame = static_cast<float>(glfwGetTime());
         deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
@@ -126,43 +247,43 @@ int main()
             lastFPSTime = currentTime;
         }
 
-        float angle = currentFrame * rotationRate * timeRatio;
-        camera.Position.x = camRotRadius * cos(angle);
-        camera.Position.z = camRotRadius * sin(angle);
-        camera.LookAtTarget(glm::vec3(0.0f, 0.0f, 0.0f));
+        profiler.beginFrame();
 
         // imgui pass 
-        setImGuiElements();
-
-        // Activate shader
-        currentObject->shader->use();
-
-        // 3D camera matrices
-        glm::mat4 view = camera.GetViewMatrix();
-        glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
-
-        // Build rotation matrix using object's method
-        // Use a static buffer large enough for any dimension we support (up to 8D = 64 floats)
-        static float rotationMatrix[64];
-        currentObject->buildRotationMatrix(rotationMatrix, currentFrame * timeRatio);
-
-        currentObject->shader->setFloatArray("rotationMat", rotationMatrix, currentObject->matrixSize());
-        currentObject->shader->setFloat("scale", currentObject->scale);
-        currentObject->shader->setMat4("view", view);
-        currentObject->shader->setMat4("projection", projection);
+        {
+            ProfileZone zone(profiler, PROFILE_IMGUI_BUILD);
+            setImGuiElements();
+        }
 
-        // draw
-        currentObject->draw();
+        // everything animated is derived from scene time alone (see frame_state.h)
+        FrameState state;
+        {
+            ProfileZone zone(profiler, PROFILE_ROTATION_BUILD);
+            state = computeFrameState(*currentObject, currentFrame * timeRatio, rotationRate, camRotRadius, camera.Position.y);
+        }
+        renderScene(state, SCR_WIDTH, SCR_HEIGHT);
 
         // draw imgui
-        ImGui::End();
-        ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        {
+            ProfileZone zone(profiler, PROFILE_IMGUI_RENDER);
+            ImGui::End();
+            ImGui::Render();
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        }
 
-        glfwSwapBuffers(window);
+        {
+            ProfileZone zone(profiler, PROFILE_SWAP);
+            glfwSwapBuffers(window);
+        }
+        profiler.endFrame();
         glfwPollEvents();
     }
 
+    if (!tracePath.empty())
+    {
+        writeChromeTrace(tracePath);
+    }
+    profiler.cleanup();
     cleanUpObjects();
 
     ImGui_ImplOpenGL3_Shutdown();
@@ -173,13 +294,271 @@ int main()
     return 0;
 }
 
+// Draw the current object for the given frame state into the bound framebuffer
+void renderScene(const FrameState& state, int width, int height)
+{
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    camera.Position = state.cameraPosition;
+    camera.LookAtTarget(glm::vec3(0.0f, 0.0f, 0.0f));
+
+    RenderPath renderPath = (RenderPath)renderPathIndex;
+    bool transparent = renderPathTransparent(renderPath);
+
+    if (showGallery)
+    {
+        Shader* shader = renderPathGalleryShader(renderPath);
+        {
+            ProfileZone zone(profiler, PROFILE_UNIFORM_UPLOAD);
+            gallery.setObjects(objectMap);
+            gallery.update(state.sceneTime, width, height);
+            shader->use();
+            shader->setMat4("view", camera.GetViewMatrix());
+            shader->setMat4("projection", glm::perspective(glm::radians(camera.Zoom), (float)width / (float)height, 0.1f, 100.0f));
+            if (transparent)
+            {
+                shader->setFloat("alpha", edgeAlpha);
+            }
+        }
+        ProfileZone zone(profiler, PROFILE_DRAW);
+        if (transparent)
+        {
+            transparencyTargets.begin(renderPath, width, height);
+        }
+        gallery.draw(*shader);
+        if (transparent)
+        {
+            transparencyTargets.resolve(densityExposure);
+        }
+        return;
+    }
+
+    if (stressInstances && !streamHypercube)
+    {
+        Shader* shader = renderPathInstancedShader(renderPath);
+        {
+            ProfileZone zone(profiler, PROFILE_UNIFORM_UPLOAD);
+            instancedObjects.setObject(*currentObject);
+            instancedObjects.setInstanceCount(stressInstanceCount);
+            shader->use();
+            shader->setMat4("view", camera.GetViewMatrix());
+            shader->setMat4("projection", glm::perspective(glm::radians(camera.Zoom), (float)width / (float)height, 0.1f, 100.0f));
+            if (transparent)
+            {
+                shader->setFloat("alpha", edgeAlpha);
+            }
+        }
+        ProfileZone zone(profiler, PROFILE_DRAW);
+        if (transparent)
+        {
+            transparencyTargets.begin(renderPath, width, height);
+        }
+        instancedObjects.draw(*shader, state.sceneTime);
+        if (transparent)
+        {
+            transparencyTargets.resolve(densityExposure);
+        }
+        return;
+    }
+
+    if (streamHypercube)
+    {
+        ProfileZone zone(profiler, PROFILE_DRAW);
+        glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)width / (float)height, 0.1f, 100.0f);
+        Shader* shader = renderPathShader(streamedHypercube.data(), renderPath);
+        if (transparent)
+        {
+            transparencyTargets.begin(renderPath, width, height);
+            shader->use();
+            shader->setFloat("alpha", edgeAlpha);
+        }
+        streamedHypercube.draw(state.sceneTime, camera.GetViewMatrix(), projection, shader);
+        if (transparent)
+        {
+            transparencyTargets.resolve(densityExposure);
+        }
+        return;
+    }
+
+    if (showScatterMatrix)
+    {
+        Shader* shader = renderPathScatterMatrixShader(renderPath);
+        {
+            ProfileZone zone(profiler, PROFILE_UNIFORM_UPLOAD);
+            shader->use();
+            shader->setFloatArray("rotationMat", state.rotationMatrix, currentObject->matrixSize());
+            if (transparent)
+            {
+                shader->setFloat("alpha", edgeAlpha);
+            }
+        }
+        ProfileZone zone(profiler, PROFILE_DRAW);
+        if (transparent)
+        {
+            transparencyTargets.begin(renderPath, width, height);
+        }
+        drawScatterMatrix(*currentObject, *shader, width, height);
+        if (transparent)
+        {
+            transparencyTargets.resolve(densityExposure);
+        }
+        return;
+    }
+
+    if (showCascade && currentObject->dimensions >= 4)
+    {
+        Shader* shader = renderPathCascadeShader(renderPath);
+        {
+            ProfileZone zone(profiler, PROFILE_UNIFORM_UPLOAD);
+            shader->use();
+            shader->setFloatArray("rotationMat", state.rotationMatrix, currentObject->matrixSize());
+            shader->setFloat("scale", currentObject->scale);
+            shader->setMat4("view", camera.GetViewMatrix());
+            if (transparent)
+            {
+                shader->setFloat("alpha", edgeAlpha);
+            }
+        }
+        ProfileZone zone(profiler, PROFILE_DRAW);
+        if (transparent)
+        {
+            transparencyTargets.begin(renderPath, width, height);
+        }
+        drawProjectionCascade(*currentObject, *shader, camera.Zoom, width, height);
+        if (transparent)
+        {
+            transparencyTargets.resolve(densityExposure);
+        }
+        return;
+    }
+
+    if (showCrossSection)
+    {
+        ProfileZone zone(profiler, PROFILE_SLICE);
+        loadLattice(*currentObject);
+        crossSection.setObject(*currentObject);
+        crossSection.update(state.rotationMatrix, sliceOffset * crossSection.circumradius());
+    }
+    bool drawFaces = showFaces && !showCrossSection;
+    if (drawFaces)
+    {
+        ProfileZone zone(profiler, PROFILE_FACE_SORT);
+        loadLattice(*currentObject);
+        filledFaces.setObject(*currentObject);
+        filledFaces.update(state.rotationMatrix, currentObject->scale, camera.GetViewMatrix());
+    }
+
+    Shader* shader = renderPathShader(*currentObject, renderPath);
+    Shader* lineShader = thickEdges ? renderPathLineShader(renderPath) : nullptr;
+    Shader* spriteShader = spriteVertices ? renderPathSpriteShader(renderPath) : nullptr;
+    {
+        ProfileZone zone(profiler, PROFILE_UNIFORM_UPLOAD);
+
+        // 3D camera matrices
+        glm::mat4 view = camera.GetViewMatrix();
+        glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)width / (float)height, 0.1f, 100.0f);
+
+        // the object's shader last, so it stays active
+        for (Shader* program : { lineShader, spriteShader, shader })
+        {
+            if (program == nullptr)
+            {
+                continue;
+            }
+            program->use();
+            program->setFloatArray("rotationMat", state.rotationMatrix, currentObject->matrixSize());
+            program->setFloat("scale", currentObject->scale);
+            program->setMat4("view", view);
+            program->setMat4("projection", projection);
+            if (transparent)
+            {
+                program->setFloat("alpha", edgeAlpha);
+            }
+        }
+    }
+
+    // draw
+    {
+        ProfileZone zone(profiler, PROFILE_DRAW);
+        if (transparent)
+        {
+            transparencyTargets.begin(renderPath, width, height);
+        }
+        // edges, then vertices, each as GL lines / points or as quads shaded by coverage
+        if (showCrossSection)
+        {
+            int dims = currentObject->dimensions;
+            if (thickEdges)
+            {
+                sectionLines.setGeometry(crossSection.vertices().data(), crossSection.vertexCount(), dims,
+                                         crossSection.edges().data(), crossSection.edgeCount());
+                lineShader->use();
+                sectionLines.draw(*lineShader, !transparent);
+            }
+            if (spriteVertices)
+            {
+                sectionSprites.setGeometry(crossSection.vertices().data(), crossSection.vertexCount(), dims);
+                spriteShader->use();
+                sectionSprites.draw(*spriteShader, !transparent);
+            }
+            shader->use();
+            crossSection.draw(*shader, !thickEdges, !spriteVertices);
+        }
+        else
+        {
+            if (currentObject->renderEdges)
+            {
+                if (thickEdges)
+                {
+                    objectLines.setObject(*currentObject);
+                    lineShader->use();
+                    objectLines.draw(*lineShader, !transparent);
+                }
+                else
+                {
+                    currentObject->drawEdges(*shader);
+                }
+            }
+            if (spriteVertices)
+            {
+                objectSprites.setObject(*currentObject);
+                spriteShader->use();
+                objectSprites.draw(*spriteShader, !transparent);
+            }
+            else
+            {
+                shader->use();
+                currentObject->drawVertices(*shader);
+            }
+            shader->use();
+        }
+        if (drawFaces)
+        {
+            // the transparent paths blend the faces themselves, in any order
+            if (transparent)
+            {
+                shader->setFloat("alpha", faceOpacity);
+            }
+            filledFaces.draw(*shader, faceOpacity, !transparent);
+        }
+        if (transparent)
+        {
+            transparencyTargets.resolve(densityExposure);
+        }
+    }
+}
+
 void setImGuiElements() {
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
-    ImGui::SetNextWindowSize(ImVec2(IMGUI_WINDOW_WIDTH, IMGUI_WINDOW_HEIGHT), ImGuiCond_Always);
-    ImGui::SetNextWindowPos(ImVec2(SCR_WIDTH - IMGUI_WINDOW_WIDTH - 20, 20), ImGuiCond_Always);
-    ImGui::Begin("Visualizer", nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove);
+    // default size on first run only; the panel is resizable, scrolls when its controls don't fit,
+    // and stays pinned to the top-right corner and within the window's height
+    ImGui::SetNextWindowSize(ImVec2(IMGUI_WINDOW_WIDTH, IMGUI_WINDOW_HEIGHT), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSizeConstraints(ImVec2(0.0f, 0.0f), ImVec2((float)SCR_WIDTH - 40.0f, (float)SCR_HEIGHT - 40.0f));
+    ImGui::SetNextWindowPos(ImVec2(SCR_WIDTH - 20.0f, 20.0f), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::Begin("Visualizer", nullptr, ImGuiWindowFlags_NoMove);
 
     ImGui::Text("FPS: %.1f", currentFPS);
     ImGui::Spacing();
@@ -188,7 +567,7 @@ void setImGuiElements() {
     // family
     ImGui::Text("Family");
     ImGui::Spacing();
-    const char* shapesList[] = { "Hypercube", "Simplex", "Cross-Polytope" };
+    const char* shapesList[] = { "Hypercube", "Simplex", "Cross-Polytope", "24-Cell", "120-Cell", "600-Cell", "E8 (4_21)", "Point Hull", "Duoprism", "Zonotope" };
     if (ImGui::Combo("##Object", &shapesIndex, shapesList, IM_ARRAYSIZE(shapesList)))
     {
         updateCurrentObject();
@@ -204,6 +583,96 @@ void setImGuiElements() {
     {
         updateCurrentObject();
     }
+    ImGui::Text("%d edges, %d indices", currentObject->edgeCount, currentObject->stripIndexCount);
+    if (currentObject->lattice != nullptr) {
+        std::string fVector;
+        for (int count : currentObject->lattice->fVector()) {
+            fVector += (fVector.empty() ? "" : ", ") + std::to_string(count);
+        }
+        ImGui::Text("f-vector (%s)", fVector.c_str());
+    }
+    if (shapesIndex == 8)
+    {
+        int sides[2];
+        getDuoprismSides(sides[0], sides[1]);
+        if (ImGui::SliderInt2("##DuoprismSides", sides, 3, DUOPRISM_MAX_SIDES, "%d-gon"))
+        {
+            setDuoprismSides(sides[0], sides[1]);
+            duoprism.deleteBuffers();
+            duoprism.setupBuffers();
+            updateCurrentObject();
+        }
+    }
+    if (shapesIndex == 9 && !zonotopeGeneratorsFromFile())
+    {
+        int generators = getZonotopeGeneratorCount();
+        if (ImGui::SliderInt("##ZonotopeGenerators", &generators, 1, ZONOTOPE_MAX_GENERATORS, "%d generators"))
+        {
+            setZonotopeGeneratorCount(generators);
+            zonotope.deleteBuffers();
+            zonotope.setupBuffers();
+            updateCurrentObject();
+        }
+    }
+    const char* operatorNames[] = { "No Operator", "Truncate", "Rectify", "Bitruncate", "Cantellate" };
+    if (ImGui::Combo("##Operator", &operatorIndex, operatorNames, IM_ARRAYSIZE(operatorNames)))
+    {
+        updateCurrentObject();
+    }
+    if (ImGui::Checkbox("Dual", &showDual))
+    {
+        updateCurrentObject();
+    }
+    ImGui::Checkbox("Cross-Section", &showCrossSection);
+    if (showCrossSection)
+    {
+        ImGui::SliderFloat("##SliceOffset", &sliceOffset, -1.0f, 1.0f, "offset %.2f");
+        ImGui::Text("section: %d vertices, %d edges", crossSection.vertexCount(), crossSection.edgeCount());
+    }
+    if (currentObject->dimensions >= 4)
+    {
+        ImGui::Checkbox("Projection Cascade", &showCascade);
+        if (showCascade)
+        {
+            ImGui::Text("%dD to 3D shadows, left to right", currentObject->dimensions - 1);
+        }
+    }
+    ImGui::Checkbox("Scatterplot Matrix", &showScatterMatrix);
+    if (showScatterMatrix)
+    {
+        ImGui::Text("%d axis pairs, 1 draw call", scatterMatrixPanels(currentObject->dimensions));
+    }
+    ImGui::Checkbox("Faces", &showFaces);
+    if (showFaces)
+    {
+        ImGui::SliderFloat("##FaceOpacity", &faceOpacity, 0.05f, 1.0f, "opacity %.2f");
+        ImGui::Text("%d faces, %d triangles", filledFaces.faceCount(), filledFaces.triangleCount());
+    }
+    ImGui::Spacing();
+    ImGui::Spacing();
+
+    ImGui::Checkbox("Gallery", &showGallery);
+    if (showGallery)
+    {
+        ImGui::Text("%d objects, 2 draw calls", gallery.objectCount());
+    }
+    ImGui::Checkbox("Instanced Stress", &stressInstances);
+    if (stressInstances)
+    {
+        ImGui::SliderInt("##StressInstances", &stressInstanceCount, 1, MAX_INSTANCES, "%d copies", ImGuiSliderFlags_Logarithmic);
+        ImGui::Text("%.2f M instances/s, %.1f M vertices/s", stressInstanceCount * currentFPS / 1e6,
+                    instancedObjects.verticesPerFrame() * currentFPS / 1e6);
+    }
+    // huge-N hypercube, generated chunk by chunk every frame
+    ImGui::Checkbox("Streamed N-Cube", &streamHypercube);
+    if (streamHypercube)
+    {
+        if (ImGui::SliderInt("##StreamDimensions", &streamDimensions, STREAM_MIN_DIMENSIONS, STREAM_MAX_DIMENSIONS, "%dD"))
+        {
+            streamedHypercube.setDimensions(streamDimensions);
+        }
+        ImGui::Text("%lld edges", streamedHypercube.edgeCount());
+    }
     ImGui::Spacing();
     ImGui::Spacing();
 
@@ -227,10 +696,44 @@ void setImGuiElements() {
 
     ImGui::SeparatorText("Display");
 
+    // Fragment shading
+    ImGui::Text("Render Path");
+    ImGui::Spacing();
+    const char* renderPathNames[] = { "Position", "Height", "Transparent (OIT)", "Density" };
+    ImGui::Combo("##RenderPath", &renderPathIndex, renderPathNames, IM_ARRAYSIZE(renderPathNames));
+    if (renderPathTransparent((RenderPath)renderPathIndex))
+    {
+        ImGui::SliderFloat("##EdgeAlpha", &edgeAlpha, 0.01f, 1.0f, "edge alpha %.2f");
+        if (renderPathIndex == RENDER_PATH_DENSITY)
+        {
+            ImGui::SliderFloat("##DensityExposure", &densityExposure, 0.05f, 4.0f, "exposure %.2f");
+        }
+    }
+    ImGui::Spacing();
+    ImGui::Spacing();
+
+    // Vertex storage of the current object
+    ImGui::Text("Vertex Format");
+    ImGui::Spacing();
+    int vertexFormatIndex = currentObject->vertexFormat;
+    const char* vertexFormatNames[VERTEX_FORMAT_COUNT];
+    for (int i = 0; i < VERTEX_FORMAT_COUNT; i++)
+    {
+        vertexFormatNames[i] = vertexFormatName((VertexFormat)i);
+    }
+    if (ImGui::Combo("##VertexFormat", &vertexFormatIndex, vertexFormatNames, VERTEX_FORMAT_COUNT))
+    {
+        currentObject->setVertexFormat((VertexFormat)vertexFormatIndex);
+    }
+    ImGui::Text("%zu bytes", currentObject->vertexBufferBytes);
+    ImGui::Spacing();
+    ImGui::Spacing();
+
     // Edge Thickness
     ImGui::Text("Edge Thickness");
     ImGui::Spacing();
     ImGui::SliderFloat("##EdgeThickness", &EDGE_THICKNESS, 0.1f, 30.0f, "%.1f px");
+    ImGui::Checkbox("Anti-Aliased Quads", &thickEdges);
     ImGui::Spacing();
     ImGui::Spacing();
 
@@ -238,13 +741,19 @@ void setImGuiElements() {
     ImGui::Text("Vertex Size");
     ImGui::Spacing();
     ImGui::SliderFloat("##VertexSize", &VERTEX_SIZE, 0.1f, 30.0f, "%.1f px");
+    ImGui::Checkbox("Disc Sprites", &spriteVertices);
     ImGui::Spacing();
     ImGui::Spacing();
 
+    profiler.drawImGui();
+
 }
 
 void initializeObjects() {
 
+    // maps (or first generates) every object's geometry
+    populateObjectMap(objectMap);
+
     hypercube2D.init();
     hypercube3D.init();
     hypercube4D.init();
@@ -269,31 +778,24 @@ void initializeObjects() {
     crossPolytope7D.init();
     crossPolytope8D.init();
 
-    // Populate object map with (shapeType, dimension) -> object
-    // Shape types: 0 = Hypercube, 1 = Hypersphere, 2 = Simplex, 3 = Cross-Polytope
-    objectMap[{0, 2}] = &hypercube2D;
-    objectMap[{0, 3}] = &hypercube3D;
-    objectMap[{0, 4}] = &hypercube4D;
-    objectMap[{0, 5}] = &hypercube5D;
-    objectMap[{0, 6}] = &hypercube6D;
-    objectMap[{0, 7}] = &hypercube7D;
-    objectMap[{0, 8}] = &hypercube8D;
-
-    objectMap[{1, 2}] = &simplex2D;
-    objectMap[{1, 3}] = &simplex3D;
-    objectMap[{1, 4}] = &simplex4D;
-    objectMap[{1, 5}] = &simplex5D;
-    objectMap[{1, 6}] = &simplex6D;
-    objectMap[{1, 7}] = &simplex7D;
-    objectMap[{1, 8}] = &simplex8D;
-
-    objectMap[{2, 2}] = &crossPolytope2D;
-    objectMap[{2, 3}] = &crossPolytope3D;
-    objectMap[{2, 4}] = &crossPolytope4D;
-    objectMap[{2, 5}] = &crossPolytope5D;
-    objectMap[{2, 6}] = &crossPolytope6D;
-    objectMap[{2, 7}] = &crossPolytope7D;
-    objectMap[{2, 8}] = &crossPolytope8D;
+    cell24.init();
+    cell120.init();
+    cell600.init();
+    gosset421.init();
+    pointHull.init();
+    duoprism.init();
+    zonotope.init();
+
+    streamedHypercube.init(streamDimensions);
+    crossSection.init();
+    filledFaces.init();
+    transparencyTargets.init();
+    objectLines.init();
+    sectionLines.init();
+    objectSprites.init();
+    sectionSprites.init();
+    gallery.init();
+    instancedObjects.init();
 }
 void cleanUpObjects() {
 
@@ -320,14 +822,54 @@ void cleanUpObjects() {
     crossPolytope6D.cleanup();
     crossPolytope7D.cleanup();
     crossPolytope8D.cleanup();
+
+    cell24.cleanup();
+    cell120.cleanup();
+    cell600.cleanup();
+    gosset421.cleanup();
+    pointHull.cleanup();
+    duoprism.cleanup();
+    zonotope.cleanup();
+    cleanupDerivedObjects();
+
+    streamedHypercube.cleanup();
+    crossSection.cleanup();
+    filledFaces.cleanup();
+    transparencyTargets.cleanup();
+    objectLines.cleanup();
+    sectionLines.cleanup();
+    objectSprites.cleanup();
+    sectionSprites.cleanup();
+    gallery.cleanup();
+    instancedObjects.cleanup();
+    cleanupRenderPathShaders();
 }
 // Helper function to update current object based on shape and dimension selection
 void updateCurrentObject() {
     int actualDimension = currentDimensionIndex + 2;  // Convert dropdown index to actual dimension (0->2, 1->3, etc.)
     auto key = std::make_pair(shapesIndex, actualDimension);
     auto it = objectMap.find(key);
+    if (it == objectMap.end()) {
+        // the uniform polytopes exist in one dimension only; switch to it
+        it = objectMap.lower_bound(std::make_pair(shapesIndex, 0));
+        if (it != objectMap.end() && it->first.first == shapesIndex) {
+            currentDimensionIndex = it->first.second - 2;
+        }
+        else {
+            it = objectMap.end();
+        }
+    }
     if (it != objectMap.end()) {
         currentObject = it->second;
+        NDimObjectData* operated = operatorIndex > 0 ? operatedObject(*currentObject, (PolytopeOperator)(operatorIndex - 1)) : nullptr;
+        if (operated != nullptr) {
+            currentObject = operated;
+        }
+        NDimObjectData* dual = showDual ? dualObject(*currentObject) : nullptr;
+        if (dual != nullptr) {
+            currentObject = dual;
+        }
+        traceInstant("Object switch", "ui");
     }
     else {
         std::cout << "No object found for shape " << shapesIndex << ", dimension " << actualDimension << std::endl;
@@ -347,6 +889,14 @@ void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
         camera.Zoom = 90.0f;
 }
 
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (key == GLFW_KEY_F9 && action == GLFW_PRESS)
+    {
+        writeChromeTrace(tracePath.empty() ? DEFAULT_TRACE_PATH : tracePath);
+    }
+}
+
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
     // make sure the viewport matches the new window dimensions; note that width and
@@ -6,6 +6,7 @@ layout(location = 0) in vec4 pos_group1;
 // 2x2 rotation matrix as 4 floats (row-major order)
 uniform float rotationMat[4];
 uniform float scale;
+uniform float positionScale;   // dequantizes snorm storage (1 for float and half)
 
 uniform mat4 view;
 uniform mat4 projection;
@@ -16,8 +17,8 @@ out vec3 fragPos;
 void main() {
     // Extract position components and apply scale
     float position[2];
-    position[0] = pos_group1.x;
-    position[1] = pos_group1.y;
+    position[0] = pos_group1.x * positionScale;
+    position[1] = pos_group1.y * positionScale;
 
     // Apply 2D rotation - Manual matrix-vector multiplication
     float rotated2D[2];
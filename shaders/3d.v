@@ -6,6 +6,7 @@ layout(location = 0) in vec4 pos_group1;
 // 3x3 rotation matrix as 9 floats (row-major order)
 uniform float rotationMat[9];
 uniform float scale;
+uniform float positionScale;   // dequantizes snorm storage (1 for float and half)
 
 uniform mat4 view;
 uniform mat4 projection;
@@ -16,9 +17,9 @@ out vec3 fragPos;
 void main() {
     // Extract position components and apply scale
     float position[3];
-    position[0] = pos_group1.x;
-    position[1] = pos_group1.y;
-    position[2] = pos_group1.z;
+    position[0] = pos_group1.x * positionScale;
+    position[1] = pos_group1.y * positionScale;
+    position[2] = pos_group1.z * positionScale;
 
     // Apply 3D rotation - Manual matrix-vector multiplication
     float rotated3D[3];
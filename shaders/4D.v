@@ -7,6 +7,7 @@ layout(location = 1) in vec4 pos_group2;
 // 4x4 rotation matrix as 16 floats (row-major order)
 uniform float rotationMat[16];
 uniform float scale;
+uniform float positionScale;   // dequantizes snorm storage (1 for float and half)
 
 uniform mat4 view;
 uniform mat4 projection;
@@ -17,10 +18,10 @@ out vec3 fragPos;
 void main() {
     // Extract position components and apply scale
     float position[4];
-    position[0] = pos_group1.x;
-    position[1] = pos_group1.y;
-    position[2] = pos_group1.z;
-    position[3] = pos_group1.w;
+    position[0] = pos_group1.x * positionScale;
+    position[1] = pos_group1.y * positionScale;
+    position[2] = pos_group1.z * positionScale;
+    position[3] = pos_group1.w * positionScale;
 
     // 1. Apply 4D rotation - Manual matrix-vector multiplication
     float rotated4D[4];
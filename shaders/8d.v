@@ -6,6 +6,7 @@ layout(location = 1) in vec4 pos_group2;
 // 8x8 matrix = 64 floats
 uniform float rotationMat[64];
 uniform float scale;
+uniform float positionScale;   // dequantizes snorm storage (1 for float and half)
 
 uniform mat4 view;
 uniform mat4 projection;
@@ -16,14 +17,14 @@ out vec3 fragPos;
 void main() {
     // Extract position components
     float position[8];
-    position[0] = pos_group1.x;
-    position[1] = pos_group1.y;
-    position[2] = pos_group1.z;
-    position[3] = pos_group1.w;
-    position[4] = pos_group2.x;
-    position[5] = pos_group2.y;
-    position[6] = pos_group2.z;
-    position[7] = pos_group2.w;
+    position[0] = pos_group1.x * positionScale;
+    position[1] = pos_group1.y * positionScale;
+    position[2] = pos_group1.z * positionScale;
+    position[3] = pos_group1.w * positionScale;
+    position[4] = pos_group2.x * positionScale;
+    position[5] = pos_group2.y * positionScale;
+    position[6] = pos_group2.z * positionScale;
+    position[7] = pos_group2.w * positionScale;
 
 	// manual mult
     float rotated8D[8];
@@ -0,0 +1,62 @@
+#version 330 core
+
+// The object's own vertex buffer and attribute layout (shaders/<N>d.v), stopped partway
+// through the N -> 3 projection chain: the shadow in stage dimensions, shown by its first
+// three coordinates.
+layout(location = 0) in vec4 pos_group1;
+layout(location = 1) in vec4 pos_group2;
+
+uniform int dimensions;             // 4 to 8
+uniform int stage;                  // 3 to dimensions - 1
+
+// NxN rotation matrix (row-major order), N = dimensions
+uniform float rotationMat[64];
+uniform float scale;
+uniform float positionScale;   // dequantizes snorm storage (1 for float and half)
+
+uniform mat4 view;
+uniform mat4 projection;
+
+out vec3 fragColor;
+out vec3 fragPos;
+
+void main() {
+    float position[8];
+    position[0] = pos_group1.x;
+    position[1] = pos_group1.y;
+    position[2] = pos_group1.z;
+    position[3] = pos_group1.w;
+    position[4] = pos_group2.x;
+    position[5] = pos_group2.y;
+    position[6] = pos_group2.z;
+    position[7] = pos_group2.w;
+    float rotated[8];
+    for (int i = 0; i < dimensions; i++) {
+        rotated[i] = 0.0;
+        for (int j = 0; j < dimensions; j++) {
+            rotated[i] += rotationMat[i * dimensions + j] * position[j] * positionScale;
+        }
+    }
+
+    // every N -> N-1 step divides by (3 + coordinate), which collapses into one running factor
+    float distance = 3.0;
+    float factor = 1.0;
+    for (int d = dimensions; d > stage; d--) {
+        float divisor = distance + rotated[d - 1] * factor;
+        if (divisor < 0.001) {
+            gl_Position = vec4(0.0);
+            fragColor = vec3(0.0);
+            fragPos = vec3(0.0);
+            return;
+        }
+        factor /= divisor;
+    }
+
+    // each step shrinks by about 3, so scale the earlier shadows down to the final one's size
+    vec3 world = vec3(rotated[0], rotated[1], rotated[2]) * factor * pow(distance, float(3 - stage)) * scale;
+    // color output will use worldspace coords
+    fragPos = world;
+
+    gl_Position = projection * view * vec4(world, 1.0);
+    fragColor = vec3(0.5 + 0.5 * rotated[stage - 1] * factor);
+}
@@ -0,0 +1,41 @@
+#version 330 core
+
+in vec3 fragColor;
+in vec3 fragPos;
+noperspective in vec2 coverageOffset;   // pixels from a line's center line or a sprite's center
+
+uniform float halfWidth;        // line half width or sprite radius, pixels
+uniform bool heightColoring;    // color-from-height.f instead of ws-coloring.f
+uniform bool accumulate;        // transparent render paths: write like oit-accumulate.f
+uniform bool depthWeighted;
+uniform float alpha;
+
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out vec4 weight;     // only bound on the transparent paths
+
+void main() {
+	// analytic coverage: the pixel's footprint (one pixel wide) against the shape's extent
+	float coverage = clamp(halfWidth + 0.5 - length(coverageOffset), 0.0, 1.0);
+	if (coverage <= 0.0) {
+		discard;
+	}
+	vec3 color = fragPos;
+	if (heightColoring) {
+		float height = fragPos.y + .7;
+		color = vec3(height);
+	}
+	if (!accumulate) {
+		FragColor = vec4(color, coverage);
+		return;
+	}
+
+	// as oit-accumulate.f, the coverage scaling the fragment's alpha
+	float a = alpha * coverage;
+	float w = 1.0;
+	if (depthWeighted) {
+		float far = 1.0 - gl_FragCoord.z;
+		w = clamp(3000.0 * far * far * far, 0.01, 3000.0);
+	}
+	FragColor = vec4(clamp(color, 0.0, 1.0) * a * w, a);
+	weight = vec4(a * w);
+}
@@ -0,0 +1,70 @@
+#version 330 core
+
+// Every object of the gallery in one vertex stream. The per-vertex attribute says which
+// object the vertex belongs to; its coordinates come from a buffer texture by vertex id.
+layout(location = 0) in uint objectIndex;
+
+uniform samplerBuffer vertexTable;  // 8 floats per vertex, unused coordinates 0
+
+// Per-object transforms, uploaded once per frame (see Gallery)
+layout(std140) uniform GalleryObjects {
+    vec4 cells[32];                 // xy: cell center (NDC), z: shrink factor
+    vec4 params[32];                // x: dimensions (2 to 8), y: scale
+    vec4 rotations[32 * 16];        // 8x8 rotation per object (row-major), 16 vec4 each
+};
+
+uniform mat4 view;
+uniform mat4 projection;
+
+out vec3 fragColor;
+out vec3 fragPos;
+
+void main() {
+    int object = int(objectIndex);
+    int dimensions = int(params[object].x);
+
+    float position[8];
+    for (int j = 0; j < dimensions; j++) {
+        position[j] = texelFetch(vertexTable, gl_VertexID * 8 + j).r;
+    }
+    float rotated[8];
+    for (int i = 0; i < dimensions; i++) {
+        rotated[i] = 0.0;
+        for (int j = 0; j < dimensions; j++) {
+            int k = i * 8 + j;
+            rotated[i] += rotations[object * 16 + k / 4][k % 4] * position[j];
+        }
+    }
+    float last = rotated[dimensions - 1];
+
+    // same projection as shaders/thick-lines.v
+    vec3 world;
+    if (dimensions < 4) {
+        world = vec3(rotated[0], rotated[1], dimensions > 2 ? rotated[2] : 0.0);
+    }
+    else {
+        float distance = 3.0;
+        float factor = 1.0;
+        for (int d = dimensions; d > 4; d--) {
+            factor /= distance + rotated[d - 1] * factor;
+        }
+        float divisor = distance + rotated[3] * factor;
+        if (divisor < 0.001) {
+            gl_Position = vec4(0.0);
+            fragColor = vec3(0.0);
+            fragPos = vec3(0.0);
+            return;
+        }
+        world = vec3(rotated[0], rotated[1], rotated[2]) * factor / divisor;
+    }
+    world *= params[object].y;
+    // color output will use worldspace coords
+    fragPos = world;
+
+    // shrink the full-window image around the cell's center
+    vec4 clip = projection * view * vec4(world, 1.0);
+    clip.xy = clip.xy * cells[object].z + cells[object].xy * clip.w;
+    gl_Position = clip;
+
+    fragColor = vec3(0.5 + 0.5 * last);
+}
@@ -0,0 +1,82 @@
+#version 330 core
+
+// One instance per copy of the object: its 3D placement and rotation phase. Vertices are
+// fetched from a buffer texture by vertex id, and the NxN rotation is rebuilt from the
+// object's rotation planes at the instance's own time, like buildRotationMatrix does.
+layout(location = 0) in vec4 instance;  // xyz: offset (world), w: phase (seconds)
+
+uniform samplerBuffer vertexTable;  // dimensions floats per vertex
+uniform int dimensions;             // 2 to 8
+
+uniform float rotationPlanes[48];   // axis1, axis2, speed per plane
+uniform int planeCount;             // up to 16
+uniform float sceneTime;
+uniform float scale;
+
+uniform mat4 view;
+uniform mat4 projection;
+
+out vec3 fragColor;
+out vec3 fragPos;
+
+void main() {
+    float rotation[64];
+    for (int i = 0; i < dimensions * dimensions; i++) {
+        rotation[i] = 0.0;
+    }
+    for (int i = 0; i < dimensions; i++) {
+        rotation[i * dimensions + i] = 1.0;
+    }
+    float time = sceneTime + instance.w;
+    for (int p = 0; p < planeCount; p++) {
+        int a = int(rotationPlanes[p * 3]);
+        int b = int(rotationPlanes[p * 3 + 1]);
+        float angle = time * rotationPlanes[p * 3 + 2];
+        float c = cos(angle);
+        float s = sin(angle);
+        rotation[a * dimensions + a] = c;
+        rotation[a * dimensions + b] = -s;
+        rotation[b * dimensions + a] = s;
+        rotation[b * dimensions + b] = c;
+    }
+
+    float position[8];
+    for (int j = 0; j < dimensions; j++) {
+        position[j] = texelFetch(vertexTable, gl_VertexID * dimensions + j).r;
+    }
+    float rotated[8];
+    for (int i = 0; i < dimensions; i++) {
+        rotated[i] = 0.0;
+        for (int j = 0; j < dimensions; j++) {
+            rotated[i] += rotation[i * dimensions + j] * position[j];
+        }
+    }
+    float last = rotated[dimensions - 1];
+
+    // same projection as shaders/thick-lines.v
+    vec3 world;
+    if (dimensions < 4) {
+        world = vec3(rotated[0], rotated[1], dimensions > 2 ? rotated[2] : 0.0);
+    }
+    else {
+        float distance = 3.0;
+        float factor = 1.0;
+        for (int d = dimensions; d > 4; d--) {
+            factor /= distance + rotated[d - 1] * factor;
+        }
+        float divisor = distance + rotated[3] * factor;
+        if (divisor < 0.001) {
+            gl_Position = vec4(0.0);
+            fragColor = vec3(0.0);
+            fragPos = vec3(0.0);
+            return;
+        }
+        world = vec3(rotated[0], rotated[1], rotated[2]) * factor / divisor;
+    }
+    world = world * scale + instance.xyz;
+    // color output will use worldspace coords
+    fragPos = world;
+
+    gl_Position = projection * view * vec4(world, 1.0);
+    fragColor = vec3(0.5 + 0.5 * last);
+}
@@ -0,0 +1,26 @@
+#version 330 core
+
+in vec3 fragColor;
+in vec3 fragPos;
+
+uniform float alpha;            // coverage of a single fragment
+uniform bool depthWeighted;     // false: plain density accumulation
+
+// rgb: weighted premultiplied color, a: multiplied down to the revealage
+layout(location = 0) out vec4 accumulation;
+// r: total weight
+layout(location = 1) out vec4 weight;
+
+void main() {
+	// same coloring as ws-coloring.f, clamped since the targets are floating point
+	vec3 color = clamp(fragPos, 0.0, 1.0);
+
+	// McGuire & Bavoil's depth weight: near fragments dominate the average
+	float w = 1.0;
+	if (depthWeighted) {
+		float far = 1.0 - gl_FragCoord.z;
+		w = clamp(3000.0 * far * far * far, 0.01, 3000.0);
+	}
+	accumulation = vec4(color * alpha * w, alpha);
+	weight = vec4(alpha * w);
+}
@@ -0,0 +1,20 @@
+#version 330 core
+
+uniform sampler2D accumulation;
+uniform sampler2D weights;
+uniform bool density;           // coverage from the fragment count instead of the revealage
+uniform float exposure;
+
+out vec4 FragColor;
+
+void main() {
+	ivec2 pixel = ivec2(gl_FragCoord.xy);
+	vec4 accum = texelFetch(accumulation, pixel, 0);
+	float total = texelFetch(weights, pixel, 0).r;
+	if (total <= 0.0) {
+		discard;
+	}
+	vec3 color = accum.rgb / max(total, 0.00001);
+	float coverage = density ? 1.0 - exp(-total * exposure) : 1.0 - accum.a;
+	FragColor = vec4(color, coverage);
+}
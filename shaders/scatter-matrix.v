@@ -0,0 +1,62 @@
+#version 330 core
+
+// The object's own vertex buffer and attribute layout (shaders/<N>d.v), drawn once per axis
+// pair (i, j), i < j: the instance picks the pair and its cell of the upper-triangular grid,
+// where the rotated vertex is projected orthogonally onto axis j (across) and axis i (up).
+layout(location = 0) in vec4 pos_group1;
+layout(location = 1) in vec4 pos_group2;
+
+uniform int dimensions;             // 2 to 8
+
+// NxN rotation matrix (row-major order), N = dimensions
+uniform float rotationMat[64];
+uniform float positionScale;   // dequantizes snorm storage (1 for float and half)
+
+uniform float extent;               // largest coordinate magnitude (the circumradius)
+uniform vec2 gridHalfSize;          // NDC half extents of the whole grid
+
+out vec3 fragColor;
+out vec3 fragPos;
+
+void main() {
+    // instance -> (i, j): row i holds the pairs (i, i + 1) ... (i, N - 1)
+    int i = 0;
+    int cell = gl_InstanceID;
+    while (cell >= dimensions - 1 - i) {
+        cell -= dimensions - 1 - i;
+        i++;
+    }
+    int j = i + 1 + cell;
+
+    float position[8];
+    position[0] = pos_group1.x;
+    position[1] = pos_group1.y;
+    position[2] = pos_group1.z;
+    position[3] = pos_group1.w;
+    position[4] = pos_group2.x;
+    position[5] = pos_group2.y;
+    position[6] = pos_group2.z;
+    position[7] = pos_group2.w;
+    float rotatedI = 0.0;
+    float rotatedJ = 0.0;
+    vec3 first = vec3(0.0);
+    for (int k = 0; k < dimensions; k++) {
+        float p = position[k] * positionScale;
+        rotatedI += rotationMat[i * dimensions + k] * p;
+        rotatedJ += rotationMat[j * dimensions + k] * p;
+        for (int c = 0; c < 3 && c < dimensions; c++) {
+            first[c] += rotationMat[c * dimensions + k] * p;
+        }
+    }
+    // color output will use the first three rotated coordinates, normalized
+    fragPos = first / extent;
+    fragColor = vec3(0.5 + 0.5 * rotatedI / extent);
+
+    // cells of the (N-1) x (N-1) grid, a tenth of each left as a margin
+    float cells = float(dimensions - 1);
+    vec2 cellSize = 2.0 * gridHalfSize / cells;
+    vec2 center = vec2(-gridHalfSize.x + (float(j - 1) + 0.5) * cellSize.x,
+                       gridHalfSize.y - (float(i) + 0.5) * cellSize.y);
+    vec2 offset = vec2(rotatedJ, rotatedI) / extent * 0.45 * cellSize;
+    gl_Position = vec4(center + offset, 0.0, 1.0);
+}
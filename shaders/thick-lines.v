@@ -0,0 +1,97 @@
+#version 330 core
+
+// One instance per edge: the two vertex indices. Vertices are fetched from a buffer
+// texture, and each edge is expanded to a screen-aligned quad (4 strip corners).
+layout(location = 0) in uvec2 edge;
+
+uniform samplerBuffer vertexTable;  // dimensions floats per vertex
+uniform int dimensions;             // 2 to 8
+
+// NxN rotation matrix (row-major order), N = dimensions
+uniform float rotationMat[64];
+uniform float scale;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec2 viewport;              // pixels
+uniform float halfWidth;            // pixels
+
+out vec3 fragColor;
+out vec3 fragPos;
+noperspective out vec2 coverageOffset; // pixels from the edge's center line (shaders/coverage.f)
+
+// Rotate and project a vertex to 3D world space, like shaders/<N>d.v. Returns false when
+// the 4D -> 3D step clips it.
+bool project(uint vertex, out vec3 world, out float last) {
+    float position[8];
+    for (int j = 0; j < dimensions; j++) {
+        position[j] = texelFetch(vertexTable, int(vertex) * dimensions + j).r;
+    }
+    float rotated[8];
+    for (int i = 0; i < dimensions; i++) {
+        rotated[i] = 0.0;
+        for (int j = 0; j < dimensions; j++) {
+            rotated[i] += rotationMat[i * dimensions + j] * position[j];
+        }
+    }
+    last = rotated[dimensions - 1];
+    if (dimensions < 4) {
+        world = vec3(rotated[0], rotated[1], dimensions > 2 ? rotated[2] : 0.0) * scale;
+        return true;
+    }
+
+    // every N -> N-1 step divides by (3 + coordinate), which collapses into one running factor
+    float distance = 3.0;
+    float factor = 1.0;
+    for (int d = dimensions; d > 4; d--) {
+        factor /= distance + rotated[d - 1] * factor;
+    }
+    float divisor = distance + rotated[3] * factor;
+    if (divisor < 0.001) {
+        world = vec3(0.0);
+        return false;
+    }
+    world = vec3(rotated[0], rotated[1], rotated[2]) * factor / divisor * scale;
+    return true;
+}
+
+void main() {
+    vec3 worldA;
+    vec3 worldB;
+    float lastA;
+    float lastB;
+    bool visible = project(edge.x, worldA, lastA);
+    visible = project(edge.y, worldB, lastB) && visible;
+
+    vec4 clipA = projection * view * vec4(worldA, 1.0);
+    vec4 clipB = projection * view * vec4(worldB, 1.0);
+    if (!visible || clipA.w <= 0.0 || clipB.w <= 0.0) {
+        gl_Position = vec4(0.0);
+        fragColor = vec3(0.0);
+        fragPos = vec3(0.0);
+        coverageOffset = vec2(0.0);
+        return;
+    }
+
+    // corner bits: 1 = end B, 2 = the side the normal points to
+    bool atB = (gl_VertexID & 1) != 0;
+    float side = (gl_VertexID & 2) != 0 ? 1.0 : -1.0;
+
+    vec2 halfViewport = 0.5 * viewport;
+    vec2 screenA = clipA.xy / clipA.w * halfViewport;
+    vec2 screenB = clipB.xy / clipB.w * halfViewport;
+    vec2 along = screenB - screenA;
+    along = dot(along, along) > 1e-8 ? normalize(along) : vec2(1.0, 0.0);
+    vec2 normal = vec2(-along.y, along.x);
+
+    // one extra pixel on every side for the coverage ramp; the ends are extended as square caps
+    float extent = halfWidth + 1.0;
+    vec2 offset = normal * side * extent + along * (atB ? extent : -extent);
+    vec4 clip = atB ? clipB : clipA;
+    clip.xy += offset / halfViewport * clip.w;
+    gl_Position = clip;
+
+    fragPos = atB ? worldB : worldA;
+    fragColor = vec3(0.5 + 0.5 * (atB ? lastB : lastA));
+    coverageOffset = vec2(side * extent, 0.0);
+}
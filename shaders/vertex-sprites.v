@@ -0,0 +1,66 @@
+#version 330 core
+
+// One instance per vertex, fetched from a buffer texture by gl_InstanceID, and expanded
+// to a screen-aligned square (4 strip corners) that shaders/coverage.f shades as a disc.
+uniform samplerBuffer vertexTable;  // dimensions floats per vertex
+uniform int dimensions;             // 2 to 8
+
+// NxN rotation matrix (row-major order), N = dimensions
+uniform float rotationMat[64];
+uniform float scale;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec2 viewport;              // pixels
+uniform float halfWidth;            // sprite radius, pixels
+
+out vec3 fragColor;
+out vec3 fragPos;
+noperspective out vec2 coverageOffset;  // pixels from the sprite's center (shaders/coverage.f)
+
+void main() {
+    float position[8];
+    for (int j = 0; j < dimensions; j++) {
+        position[j] = texelFetch(vertexTable, gl_InstanceID * dimensions + j).r;
+    }
+    float rotated[8];
+    for (int i = 0; i < dimensions; i++) {
+        rotated[i] = 0.0;
+        for (int j = 0; j < dimensions; j++) {
+            rotated[i] += rotationMat[i * dimensions + j] * position[j];
+        }
+    }
+
+    // N-D -> 3D as in shaders/thick-lines.v
+    vec3 world;
+    if (dimensions < 4) {
+        world = vec3(rotated[0], rotated[1], dimensions > 2 ? rotated[2] : 0.0) * scale;
+    }
+    else {
+        float distance = 3.0;
+        float factor = 1.0;
+        for (int d = dimensions; d > 4; d--) {
+            factor /= distance + rotated[d - 1] * factor;
+        }
+        float divisor = distance + rotated[3] * factor;
+        if (divisor < 0.001) {
+            gl_Position = vec4(0.0);
+            fragColor = vec3(0.0);
+            fragPos = vec3(0.0);
+            coverageOffset = vec2(0.0);
+            return;
+        }
+        world = vec3(rotated[0], rotated[1], rotated[2]) * factor / divisor * scale;
+    }
+
+    vec4 clip = projection * view * vec4(world, 1.0);
+    // one extra pixel for the coverage ramp
+    vec2 corner = vec2((gl_VertexID & 1) != 0 ? 1.0 : -1.0, (gl_VertexID & 2) != 0 ? 1.0 : -1.0);
+    vec2 offset = corner * (halfWidth + 1.0);
+    clip.xy += offset / (0.5 * viewport) * clip.w;
+    gl_Position = clip;
+
+    fragPos = world;
+    fragColor = vec3(0.5 + 0.5 * rotated[dimensions - 1]);
+    coverageOffset = offset;
+}
@@ -0,0 +1,220 @@
+#include "cross_section.h"
+
+#include <algorithm>
+#include <cmath>
+#include "face_lattice.h"
+#include "projection.h"
+#include "trace.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define CROSS_SECTION_SSE 1
+#endif
+
+void CrossSection::init() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBindVertexArray(0);
+    attributeDims = 0;
+    indicesDirty = true;
+}
+
+void CrossSection::cleanup() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(1, &EBO);
+    VAO = VBO = EBO = 0;
+}
+
+void CrossSection::setObject(const NDimObjectData& source) {
+    if (&source == object && source.geometryGeneration == objectGeneration) {
+        return;
+    }
+    object = &source;
+    objectGeneration = source.geometryGeneration;
+    dims = source.dimensions;
+    count = source.vertexCount;
+    paddedCount = (count + 3) & ~3;
+
+    components.assign((size_t)dims * paddedCount, 0.0f);
+    radius = 0.0f;
+    for (int v = 0; v < count; v++) {
+        float r = 0.0f;
+        for (int j = 0; j < dims; j++) {
+            float x = source.vertices[(size_t)v * dims + j];
+            components[(size_t)j * paddedCount + v] = x;
+            r += x * x;
+        }
+        radius = std::max(radius, std::sqrt(r));
+    }
+    distance.assign(paddedCount, 0.0f);
+    below.assign(paddedCount / 32 + 1, 0u);
+    previousBelow.clear();
+
+    edgeEnds.clear();
+    faceCut.clear();
+    const FaceLattice* lattice = source.lattice;
+    if (lattice != nullptr && !lattice->empty() && lattice->dimensions >= 2) {
+        for (int e = lattice->firstFace(1); e < lattice->firstFace(1) + lattice->faceCount(1); e++) {
+            edgeEnds.insert(edgeEnds.end(), lattice->faceVertices(e), lattice->faceVertices(e) + 2);
+        }
+        if (lattice->dimensions >= 3) {
+            faceCut.assign(lattice->faceCount(2), -1);
+        }
+    }
+    else {
+        edgeEnds.assign(source.edges, source.edges + 2 * source.edgeCount);
+    }
+}
+
+void CrossSection::classify(const float* normal, float offset) {
+    std::fill(below.begin(), below.end(), 0u);
+#ifdef CROSS_SECTION_SSE
+    __m128 weights[MAX_PROJECTION_DIMENSIONS];
+    for (int j = 0; j < dims; j++) {
+        weights[j] = _mm_set1_ps(normal[j]);
+    }
+    const __m128 start = _mm_set1_ps(-offset);
+    const __m128 zero = _mm_setzero_ps();
+    for (int v = 0; v < paddedCount; v += 4) {
+        __m128 sum = start;
+        for (int j = 0; j < dims; j++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(weights[j], _mm_loadu_ps(&components[(size_t)j * paddedCount + v])));
+        }
+        _mm_storeu_ps(&distance[v], sum);
+        below[v >> 5] |= (uint32_t)_mm_movemask_ps(_mm_cmplt_ps(sum, zero)) << (v & 31);
+    }
+#else
+    for (int v = 0; v < paddedCount; v++) {
+        float sum = -offset;
+        for (int j = 0; j < dims; j++) {
+            sum += normal[j] * components[(size_t)j * paddedCount + v];
+        }
+        distance[v] = sum;
+        if (sum < 0.0f) {
+            below[v >> 5] |= 1u << (v & 31);
+        }
+    }
+#endif
+    // the padding lanes are not vertices
+    for (int v = count; v < paddedCount; v++) {
+        below[v >> 5] &= ~(1u << (v & 31));
+    }
+}
+
+void CrossSection::rebuildTopology() {
+    TraceScope trace("Cross-section topology", "slice");
+    cutEdges.clear();
+    cutEnds.clear();
+    sectionEdges.clear();
+    auto isBelow = [this](unsigned int v) { return (below[v >> 5] >> (v & 31)) & 1; };
+    for (size_t e = 0; e < edgeEnds.size() / 2; e++) {
+        unsigned int a = edgeEnds[2 * e];
+        unsigned int b = edgeEnds[2 * e + 1];
+        if (isBelow(a) != isBelow(b)) {
+            cutEdges.push_back((unsigned int)e);
+            cutEnds.push_back(a);
+            cutEnds.push_back(b);
+        }
+    }
+
+    const FaceLattice* lattice = object->lattice;
+    if (edgeEnds.empty() || lattice == nullptr || lattice->empty()) {
+        return;
+    }
+    if (lattice->dimensions == 2) {
+        // the polygon itself is the only 2-face
+        if (cutEdges.size() == 2) {
+            sectionEdges.push_back(0);
+            sectionEdges.push_back(1);
+        }
+        return;
+    }
+    // a hyperplane crosses a convex polygon's boundary at most twice
+    int firstEdge = lattice->firstFace(1);
+    int firstFace = lattice->firstFace(2);
+    for (size_t c = 0; c < cutEdges.size(); c++) {
+        int edge = firstEdge + (int)cutEdges[c];
+        const unsigned int* faces = lattice->coface(edge);
+        for (int k = 0; k < lattice->cofaceCount(edge); k++) {
+            int& first = faceCut[faces[k] - firstFace];
+            if (first < 0) {
+                first = (int)c;
+            }
+            else {
+                sectionEdges.push_back((unsigned int)first);
+                sectionEdges.push_back((unsigned int)c);
+            }
+        }
+    }
+    for (size_t c = 0; c < cutEdges.size(); c++) {
+        int edge = firstEdge + (int)cutEdges[c];
+        const unsigned int* faces = lattice->coface(edge);
+        for (int k = 0; k < lattice->cofaceCount(edge); k++) {
+            faceCut[faces[k] - firstFace] = -1;
+        }
+    }
+}
+
+bool CrossSection::update(const float* rotation, float offset) {
+    if (object == nullptr) {
+        return false;
+    }
+    // the rotated last coordinate is the last row of the rotation applied to the vertex
+    classify(rotation + (size_t)(dims - 1) * dims, offset);
+    bool rebuilt = previousBelow != below;
+    if (rebuilt) {
+        rebuildTopology();
+        previousBelow = below;
+        indicesDirty = true;
+    }
+
+    sectionVertices.resize(cutEnds.size() / 2 * dims);
+    const float* vertices = object->vertices;
+    for (size_t c = 0; c < cutEnds.size() / 2; c++) {
+        unsigned int a = cutEnds[2 * c];
+        unsigned int b = cutEnds[2 * c + 1];
+        float t = distance[a] / (distance[a] - distance[b]);
+        const float* pa = vertices + (size_t)a * dims;
+        const float* pb = vertices + (size_t)b * dims;
+        float* out = &sectionVertices[c * dims];
+        for (int j = 0; j < dims; j++) {
+            out[j] = pa[j] + t * (pb[j] - pa[j]);
+        }
+    }
+    return rebuilt;
+}
+
+void CrossSection::draw(Shader& shader, bool edges, bool vertices) {
+    if (sectionVertices.empty()) {
+        return;
+    }
+    shader.setFloat("positionScale", 1.0f);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sectionVertices.size() * sizeof(float), sectionVertices.data(), GL_STREAM_DRAW);
+
+    // same attribute layout as NDimObjectData with Float32 storage
+    if (attributeDims != dims) {
+        setupVertexAttributes(dims, VERTEX_FORMAT_FLOAT32, (MAX_PROJECTION_DIMENSIONS + 3) / 4);
+        attributeDims = dims;
+    }
+    if (indicesDirty) {
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sectionEdges.size() * sizeof(unsigned int), sectionEdges.data(), GL_STREAM_DRAW);
+        indicesDirty = false;
+    }
+
+    if (edges && !sectionEdges.empty()) {
+        glLineWidth(EDGE_THICKNESS);
+        glDrawElements(GL_LINES, (GLsizei)sectionEdges.size(), GL_UNSIGNED_INT, (void*)0);
+    }
+    if (vertices) {
+        glPointSize(VERTEX_SIZE);
+        glDrawArrays(GL_POINTS, 0, vertexCount());
+    }
+    glBindVertexArray(0);
+}
@@ -0,0 +1,100 @@
+#include "edge_strips.h"
+
+#include <cstddef>
+
+void buildLineStrips(int vertexCount, const unsigned int* edges, int edgeCount, std::vector<unsigned int>& indices) {
+    struct Incidence {
+        unsigned int neighbour;
+        int edge;
+    };
+
+    int realEdges = edgeCount;
+    std::vector<std::vector<Incidence>> adjacency(vertexCount);
+    for (int e = 0; e < realEdges; e++) {
+        unsigned int a = edges[2 * e];
+        unsigned int b = edges[2 * e + 1];
+        adjacency[a].push_back({ b, e });
+        adjacency[b].push_back({ a, e });
+    }
+
+    // pair odd-degree vertices with virtual edges (ids >= realEdges) so every degree is even
+    int totalEdges = realEdges;
+    int pendingOdd = -1;
+    for (int v = 0; v < vertexCount; v++) {
+        if (adjacency[v].size() % 2 == 0) {
+            continue;
+        }
+        if (pendingOdd < 0) {
+            pendingOdd = v;
+        }
+        else {
+            adjacency[pendingOdd].push_back({ (unsigned int)v, totalEdges });
+            adjacency[v].push_back({ (unsigned int)pendingOdd, totalEdges });
+            totalEdges++;
+            pendingOdd = -1;
+        }
+    }
+
+    std::vector<bool> used(totalEdges, false);
+    std::vector<size_t> next(vertexCount, 0);
+    std::vector<Incidence> stack;
+    std::vector<Incidence> circuit;       // vertex, and the edge leading to the following entry
+
+    indices.clear();
+    indices.reserve(realEdges + realEdges / 2 + 2);
+    bool firstStrip = true;
+
+    for (int start = 0; start < vertexCount; start++) {
+        // Hierholzer: walk until stuck, then back up, emitting the circuit in reverse
+        circuit.clear();
+        stack.push_back({ (unsigned int)start, -1 });
+        while (!stack.empty()) {
+            unsigned int v = stack.back().neighbour;
+            std::vector<Incidence>& around = adjacency[v];
+            while (next[v] < around.size() && used[around[next[v]].edge]) {
+                next[v]++;
+            }
+            if (next[v] < around.size()) {
+                const Incidence& step = around[next[v]];
+                used[step.edge] = true;
+                stack.push_back(step);
+            }
+            else {
+                circuit.push_back(stack.back());
+                stack.pop_back();
+            }
+        }
+        if (circuit.size() < 2) {
+            continue;
+        }
+
+        // the circuit is closed; start right after a virtual edge so no strip wraps around
+        size_t edgeCount = circuit.size() - 1;
+        size_t offset = 0;
+        for (size_t k = 0; k < edgeCount; k++) {
+            if (circuit[k].edge >= realEdges) {
+                offset = k + 1;
+                break;
+            }
+        }
+
+        bool stripOpen = false;
+        for (size_t k = 0; k < edgeCount; k++) {
+            const Incidence& from = circuit[(offset + k) % edgeCount];
+            const Incidence& to = circuit[(offset + k) % edgeCount + 1];
+            if (from.edge >= realEdges) {
+                stripOpen = false;
+                continue;
+            }
+            if (!stripOpen) {
+                if (!firstStrip) {
+                    indices.push_back(STRIP_RESTART_INDEX);
+                }
+                indices.push_back(from.neighbour);
+                firstStrip = false;
+                stripOpen = true;
+            }
+            indices.push_back(to.neighbour);
+        }
+    }
+}
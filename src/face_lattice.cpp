@@ -0,0 +1,405 @@
+#include "face_lattice.h"
+
+#include <algorithm>
+#include <iterator>
+#include <iostream>
+#include <unordered_set>
+#include "parallel_for.h"
+#include "polytope_cache.h"
+#include "trace.h"
+
+namespace {
+
+typedef std::vector<unsigned int> VertexSet;
+
+// Faces of one rank, hashed by vertex set but stored as their index into the rank's level,
+// so numbering the distinct faces copies no vertex sets
+struct FaceIndexHash {
+    const std::vector<VertexSet>* level;
+    size_t operator()(unsigned int face) const {
+        const VertexSet& set = (*level)[face];
+        return (size_t)fnv1a64(set.data(), set.size() * sizeof(unsigned int));
+    }
+};
+
+struct FaceIndexEqual {
+    const std::vector<VertexSet>* level;
+    bool operator()(unsigned int a, unsigned int b) const { return (*level)[a] == (*level)[b]; }
+};
+
+// Per-thread scratch for intersecting one face with every facet that touches it
+struct IntersectScratch {
+    std::vector<int> slot;                    // facet -> index into candidates, -1 if untouched
+    std::vector<int> touched;
+    std::vector<VertexSet> candidates;
+    std::vector<const VertexSet*> sets;
+};
+
+// Keep the inclusion-maximal sets among scratch.sets (largest first, so a set can only be
+// contained in one kept before it; a repeated set is dropped as contained in its first copy)
+void keepMaximal(IntersectScratch& scratch, std::vector<VertexSet>& out) {
+    std::vector<const VertexSet*>& sets = scratch.sets;
+    std::stable_sort(sets.begin(), sets.end(), [](const VertexSet* a, const VertexSet* b) {
+        return a->size() > b->size();
+    });
+
+    out.clear();
+    for (const VertexSet* set : sets) {
+        bool maximal = true;
+        for (const VertexSet& kept : out) {
+            if (std::includes(kept.begin(), kept.end(), set->begin(), set->end())) {
+                maximal = false;
+                break;
+            }
+        }
+        if (maximal) {
+            out.push_back(*set);
+        }
+    }
+}
+
+// The ridges of a facet: inclusion-maximal sets among facet & F over the other facets F
+// that meet it. A (k-1)-face has at least k vertices, so smaller intersections are skipped.
+void facetsBelow(const VertexSet& face, size_t minSize, const std::vector<unsigned int>& vertexFacetOffsets,
+                 const std::vector<unsigned int>& vertexFacets, IntersectScratch& scratch, std::vector<VertexSet>& out) {
+    scratch.touched.clear();
+    for (unsigned int v : face) {
+        for (unsigned int i = vertexFacetOffsets[v]; i < vertexFacetOffsets[v + 1]; i++) {
+            int facet = (int)vertexFacets[i];
+            if (scratch.slot[facet] < 0) {
+                scratch.slot[facet] = (int)scratch.touched.size();
+                if (scratch.candidates.size() <= scratch.touched.size()) {
+                    scratch.candidates.emplace_back();
+                }
+                scratch.candidates[scratch.touched.size()].clear();
+                scratch.touched.push_back(facet);
+            }
+            scratch.candidates[scratch.slot[facet]].push_back(v);
+        }
+    }
+
+    scratch.sets.clear();
+    for (size_t i = 0; i < scratch.touched.size(); i++) {
+        scratch.slot[scratch.touched[i]] = -1;
+        size_t size = scratch.candidates[i].size();
+        if (size >= minSize && size < face.size()) {
+            scratch.sets.push_back(&scratch.candidates[i]);
+        }
+    }
+    keepMaximal(scratch, out);
+}
+
+// The (k-1)-faces of a k-face G below the facets: G is a facet of its parent (k+1)-face Q,
+// so they are the ridges of Q inside G, i.e. the maximal sets among G & G' over the other
+// facets G' of Q. Q has far fewer facets than the polytope has facets touching G, and
+// the Q with the fewest is used.
+void facesBelow(const VertexSet& face, size_t minSize, const std::vector<VertexSet>& level, const std::vector<unsigned int>& siblings,
+                IntersectScratch& scratch, std::vector<VertexSet>& out) {
+    if (scratch.candidates.size() < siblings.size()) {
+        scratch.candidates.resize(siblings.size());
+    }
+    scratch.sets.clear();
+    for (size_t i = 0; i < siblings.size(); i++) {
+        const VertexSet& sibling = level[siblings[i]];
+        VertexSet& common = scratch.candidates[i];
+        common.clear();
+        std::set_intersection(face.begin(), face.end(), sibling.begin(), sibling.end(), std::back_inserter(common));
+        if (common.size() >= minSize && common.size() < face.size()) {
+            scratch.sets.push_back(&common);
+        }
+    }
+    keepMaximal(scratch, out);
+}
+
+void buildCofaces(FaceLattice& lattice) {
+    int total = lattice.totalFaces();
+    lattice.cofaceOffsets.assign((size_t)total + 1, 0);
+    for (unsigned int below : lattice.boundaryFaces) {
+        lattice.cofaceOffsets[below + 1]++;
+    }
+    for (int f = 0; f < total; f++) {
+        lattice.cofaceOffsets[f + 1] += lattice.cofaceOffsets[f];
+    }
+    lattice.cofaces.resize(lattice.boundaryFaces.size());
+    std::vector<unsigned int> fill(lattice.cofaceOffsets.begin(), lattice.cofaceOffsets.end() - 1);
+    for (int f = 0; f < total; f++) {
+        for (unsigned int i = lattice.boundaryOffsets[f]; i < lattice.boundaryOffsets[f + 1]; i++) {
+            lattice.cofaces[fill[lattice.boundaryFaces[i]]++] = (unsigned int)f;
+        }
+    }
+}
+
+// CSR offsets start at 0, never decrease and end at the size of the list they index
+bool validOffsets(const std::vector<unsigned int>& offsets, size_t listSize) {
+    if (offsets.front() != 0 || offsets.back() != listSize) {
+        return false;
+    }
+    for (size_t i = 1; i < offsets.size(); i++) {
+        if (offsets[i] < offsets[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+std::vector<int> FaceLattice::fVector() const {
+    std::vector<int> counts;
+    for (int rank = 0; rank < dimensions; rank++) {
+        counts.push_back(faceCount(rank));
+    }
+    return counts;
+}
+
+bool buildFaceLattice(const PolytopeMesh& mesh, FaceLattice& lattice, int threadCount) {
+    TraceScope trace("Build face lattice", "geometry");
+    lattice = FaceLattice();
+    const int dims = mesh.dimensions;
+    const int vertexCount = mesh.vertexCount();
+    const int facetCount = mesh.facetCount();
+    if (dims < 2 || facetCount == 0) {
+        std::cout << "ERROR::FACE_LATTICE::NO_FACETS" << std::endl;
+        return false;
+    }
+    threadCount = parallelThreadCount(threadCount);
+
+    // vertex -> facets containing it
+    std::vector<unsigned int> vertexFacetOffsets((size_t)vertexCount + 1, 0);
+    for (unsigned int v : mesh.facetVertices) {
+        vertexFacetOffsets[v + 1]++;
+    }
+    for (int v = 0; v < vertexCount; v++) {
+        vertexFacetOffsets[v + 1] += vertexFacetOffsets[v];
+    }
+    std::vector<unsigned int> vertexFacets(mesh.facetVertices.size());
+    {
+        std::vector<unsigned int> fill(vertexFacetOffsets.begin(), vertexFacetOffsets.end() - 1);
+        for (int f = 0; f < facetCount; f++) {
+            for (unsigned int i = mesh.facetOffsets[f]; i < mesh.facetOffsets[f + 1]; i++) {
+                vertexFacets[fill[mesh.facetVertices[i]]++] = (unsigned int)f;
+            }
+        }
+    }
+
+    // levels[k] holds the vertex sets of the k-faces, boundaries[k] their (k-1)-faces by index
+    // in levels[k-1], and parents[k] the (k+1)-face with the fewest facets containing each
+    std::vector<std::vector<VertexSet>> levels(dims);
+    std::vector<std::vector<std::vector<unsigned int>>> boundaries(dims);
+    std::vector<std::vector<unsigned int>> parents(dims);
+    for (int f = 0; f < facetCount; f++) {
+        VertexSet facet(mesh.facetVertices.begin() + mesh.facetOffsets[f], mesh.facetVertices.begin() + mesh.facetOffsets[f + 1]);
+        std::sort(facet.begin(), facet.end());
+        levels[dims - 1].push_back(facet);
+    }
+
+    std::vector<IntersectScratch> scratch(threadCount);
+    for (IntersectScratch& s : scratch) {
+        s.slot.assign(facetCount, -1);
+    }
+    for (int rank = dims - 1; rank >= 1; rank--) {
+        const std::vector<VertexSet>& faces = levels[rank];
+        std::vector<std::vector<VertexSet>> below(faces.size());
+        parallelFor((int)faces.size(), threadCount, [&](int i, int worker) {
+            if (rank == dims - 1) {
+                facetsBelow(faces[i], rank, vertexFacetOffsets, vertexFacets, scratch[worker], below[i]);
+            }
+            else {
+                facesBelow(faces[i], rank, faces, boundaries[rank + 1][parents[rank][i]], scratch[worker], below[i]);
+            }
+        });
+
+        // merge: number the distinct (k-1)-faces in order of first appearance
+        std::vector<std::vector<unsigned int>>& boundary = boundaries[rank];
+        boundary.resize(faces.size());
+        std::vector<VertexSet>& next = levels[rank - 1];
+        std::unordered_set<unsigned int, FaceIndexHash, FaceIndexEqual> ids(0, FaceIndexHash{ &next }, FaceIndexEqual{ &next });
+        for (size_t i = 0; i < faces.size(); i++) {
+            for (VertexSet& face : below[i]) {
+                if (rank == 1) {
+                    if (face.size() != 1 || faces[i].size() != 2) {
+                        std::cout << "ERROR::FACE_LATTICE::NOT_A_POLYTOPE" << std::endl;
+                        return false;
+                    }
+                    boundary[i].push_back(face[0]);
+                    continue;
+                }
+                // tentatively append the face; drop it again if it is already numbered
+                next.push_back(std::move(face));
+                auto inserted = ids.insert((unsigned int)next.size() - 1);
+                unsigned int id = *inserted.first;
+                if (inserted.second) {
+                    parents[rank - 1].push_back((unsigned int)i);
+                }
+                else {
+                    next.pop_back();
+                    if (below[i].size() < below[parents[rank - 1][id]].size()) {
+                        parents[rank - 1][id] = (unsigned int)i;
+                    }
+                }
+                boundary[i].push_back(id);
+            }
+        }
+    }
+
+    // vertices are the rank-0 faces, in index order
+    levels[0].resize(vertexCount);
+    for (int v = 0; v < vertexCount; v++) {
+        levels[0][v].assign(1, (unsigned int)v);
+    }
+
+    lattice.dimensions = dims;
+    lattice.rankOffsets.assign(1, 0);
+    for (int rank = 0; rank < dims; rank++) {
+        lattice.rankOffsets.push_back(lattice.rankOffsets.back() + (unsigned int)levels[rank].size());
+    }
+    lattice.vertexOffsets.assign(1, 0);
+    lattice.boundaryOffsets.assign(1, 0);
+    for (int rank = 0; rank < dims; rank++) {
+        unsigned int belowBase = rank > 0 ? lattice.rankOffsets[rank - 1] : 0;
+        for (size_t i = 0; i < levels[rank].size(); i++) {
+            const VertexSet& face = levels[rank][i];
+            lattice.vertexIndices.insert(lattice.vertexIndices.end(), face.begin(), face.end());
+            lattice.vertexOffsets.push_back((unsigned int)lattice.vertexIndices.size());
+            if (rank > 0) {
+                for (unsigned int b : boundaries[rank][i]) {
+                    lattice.boundaryFaces.push_back(belowBase + b);
+                }
+            }
+            lattice.boundaryOffsets.push_back((unsigned int)lattice.boundaryFaces.size());
+        }
+    }
+    buildCofaces(lattice);
+
+    // Euler-Poincare: f0 - f1 + ... +- f_{N-1} = 1 - (-1)^N
+    long long euler = 0;
+    for (int rank = 0; rank < dims; rank++) {
+        euler += rank % 2 == 0 ? lattice.faceCount(rank) : -lattice.faceCount(rank);
+    }
+    if (euler != (dims % 2 == 0 ? 0 : 2)) {
+        std::cout << "ERROR::FACE_LATTICE::EULER_CHARACTERISTIC " << euler << std::endl;
+        lattice = FaceLattice();
+        return false;
+    }
+    return true;
+}
+
+void dualFaceLattice(const FaceLattice& lattice, FaceLattice& dual) {
+    TraceScope trace("Dual face lattice", "geometry");
+    dual = FaceLattice();
+    if (lattice.empty()) {
+        return;
+    }
+    const int dims = lattice.dimensions;
+    const int total = lattice.totalFaces();
+    dual.dimensions = dims;
+    dual.rankOffsets.assign((size_t)dims + 1, 0);
+    for (int k = 0; k < dims; k++) {
+        dual.rankOffsets[k + 1] = dual.rankOffsets[k] + lattice.faceCount(dims - 1 - k);
+    }
+    // primal face id -> dual face id
+    std::vector<unsigned int> toDual(total);
+    for (int rank = 0; rank < dims; rank++) {
+        unsigned int base = dual.rankOffsets[dims - 1 - rank];
+        for (int i = 0; i < lattice.faceCount(rank); i++) {
+            toDual[lattice.firstFace(rank) + i] = base + i;
+        }
+    }
+
+    // Visiting primal ranks from the facets down visits dual ids in order, and every
+    // coface's facet set is complete before the faces below it need it
+    dual.vertexOffsets.reserve((size_t)total + 1);
+    dual.boundaryOffsets.reserve((size_t)total + 1);
+    dual.vertexOffsets.push_back(0);
+    dual.boundaryOffsets.push_back(0);
+    dual.boundaryFaces.reserve(lattice.cofaces.size());
+    VertexSet merged;
+    for (int rank = dims - 1; rank >= 0; rank--) {
+        for (int f = lattice.firstFace(rank); f < lattice.firstFace(rank) + lattice.faceCount(rank); f++) {
+            merged.clear();
+            if (rank == dims - 1) {
+                merged.push_back((unsigned int)(f - lattice.firstFace(rank)));
+            }
+            for (int i = 0; i < lattice.cofaceCount(f); i++) {
+                unsigned int above = toDual[lattice.coface(f)[i]];
+                merged.insert(merged.end(), dual.vertexIndices.begin() + dual.vertexOffsets[above],
+                              dual.vertexIndices.begin() + dual.vertexOffsets[above + 1]);
+                dual.boundaryFaces.push_back(above);
+            }
+            std::sort(merged.begin(), merged.end());
+            merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+            dual.vertexIndices.insert(dual.vertexIndices.end(), merged.begin(), merged.end());
+            dual.vertexOffsets.push_back((unsigned int)dual.vertexIndices.size());
+            dual.boundaryOffsets.push_back((unsigned int)dual.boundaryFaces.size());
+        }
+    }
+    buildCofaces(dual);
+}
+
+// Layout: dimensions, totalFaces, vertexIndexCount, boundaryCount, rankOffsets (dimensions + 1),
+// vertexOffsets (totalFaces + 1), vertexIndices, boundaryOffsets (totalFaces + 1), boundaryFaces
+void serializeFaceLattice(const FaceLattice& lattice, std::vector<unsigned int>& words) {
+    words.clear();
+    if (lattice.empty()) {
+        return;
+    }
+    words.push_back((unsigned int)lattice.dimensions);
+    words.push_back((unsigned int)lattice.totalFaces());
+    words.push_back((unsigned int)lattice.vertexIndices.size());
+    words.push_back((unsigned int)lattice.boundaryFaces.size());
+    words.insert(words.end(), lattice.rankOffsets.begin(), lattice.rankOffsets.end());
+    words.insert(words.end(), lattice.vertexOffsets.begin(), lattice.vertexOffsets.end());
+    words.insert(words.end(), lattice.vertexIndices.begin(), lattice.vertexIndices.end());
+    words.insert(words.end(), lattice.boundaryOffsets.begin(), lattice.boundaryOffsets.end());
+    words.insert(words.end(), lattice.boundaryFaces.begin(), lattice.boundaryFaces.end());
+}
+
+bool deserializeFaceLattice(const unsigned int* words, size_t wordCount, int vertexCount, FaceLattice& lattice) {
+    lattice = FaceLattice();
+    if (wordCount < 4) {
+        return false;
+    }
+    size_t dims = words[0];
+    size_t total = words[1];
+    size_t vertexIndexCount = words[2];
+    size_t boundaryCount = words[3];
+    if (dims == 0 || wordCount != 4 + (dims + 1) + 2 * (total + 1) + vertexIndexCount + boundaryCount) {
+        std::cout << "ERROR::FACE_LATTICE::BAD_SIZE" << std::endl;
+        return false;
+    }
+    const unsigned int* p = words + 4;
+    lattice.dimensions = (int)dims;
+    lattice.rankOffsets.assign(p, p + dims + 1);
+    p += dims + 1;
+    lattice.vertexOffsets.assign(p, p + total + 1);
+    p += total + 1;
+    lattice.vertexIndices.assign(p, p + vertexIndexCount);
+    p += vertexIndexCount;
+    lattice.boundaryOffsets.assign(p, p + total + 1);
+    p += total + 1;
+    lattice.boundaryFaces.assign(p, p + boundaryCount);
+
+    // every index is checked here, once, so the lattice walks and face rendering can trust them
+    bool valid = validOffsets(lattice.rankOffsets, total) && validOffsets(lattice.vertexOffsets, vertexIndexCount)
+        && validOffsets(lattice.boundaryOffsets, boundaryCount)
+        && lattice.rankOffsets[1] == (unsigned int)vertexCount;
+    for (size_t i = 0; valid && i < vertexIndexCount; i++) {
+        valid = lattice.vertexIndices[i] < (unsigned int)vertexCount;
+    }
+    for (size_t rank = 0; valid && rank < dims; rank++) {
+        // a k-face's boundary lies in rank k - 1; vertices have none
+        unsigned int below = rank == 0 ? 0 : lattice.rankOffsets[rank - 1];
+        unsigned int first = lattice.rankOffsets[rank];
+        unsigned int end = lattice.boundaryOffsets[lattice.rankOffsets[rank + 1]];
+        for (unsigned int i = lattice.boundaryOffsets[first]; valid && i < end; i++) {
+            valid = lattice.boundaryFaces[i] >= below && lattice.boundaryFaces[i] < first;
+        }
+    }
+    if (!valid) {
+        std::cout << "ERROR::FACE_LATTICE::BAD_OFFSETS" << std::endl;
+        lattice = FaceLattice();
+        return false;
+    }
+    buildCofaces(lattice);
+    return true;
+}
@@ -0,0 +1,161 @@
+#include "filled_faces.h"
+
+#include "face_lattice.h"
+#include "projection.h"
+#include "trace.h"
+
+namespace {
+
+// Walk a polygon's boundary edges (vertex pairs) into its vertices in cyclic order
+void appendCycle(const std::vector<unsigned int>& ends, std::vector<unsigned int>& cycle, std::vector<bool>& used) {
+    size_t edgeCount = ends.size() / 2;
+    used.assign(edgeCount, false);
+    used[0] = true;
+    unsigned int first = ends[0];
+    unsigned int current = ends[1];
+    cycle.push_back(first);
+    while (current != first) {
+        cycle.push_back(current);
+        size_t e = 1;
+        while (e < edgeCount && (used[e] || (ends[2 * e] != current && ends[2 * e + 1] != current))) {
+            e++;
+        }
+        if (e == edgeCount) {
+            break;
+        }
+        used[e] = true;
+        current = ends[2 * e] == current ? ends[2 * e + 1] : ends[2 * e];
+    }
+}
+
+} // namespace
+
+void FilledFaces::init() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBindVertexArray(0);
+    verticesDirty = true;
+}
+
+void FilledFaces::cleanup() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(1, &EBO);
+    VAO = VBO = EBO = 0;
+}
+
+void FilledFaces::setObject(const NDimObjectData& source) {
+    if (&source == object && source.geometryGeneration == objectGeneration) {
+        return;
+    }
+    TraceScope trace("Face triangulation", "faces");
+    object = &source;
+    objectGeneration = source.geometryGeneration;
+    dims = source.dimensions;
+    verticesDirty = true;
+
+    corners.clear();
+    cornerOffsets.assign(1, 0);
+    const FaceLattice* lattice = source.lattice;
+    if (lattice != nullptr && !lattice->empty() && lattice->dimensions >= 2) {
+        std::vector<unsigned int> ends;
+        std::vector<bool> used;
+        auto addEdge = [&ends, lattice](int edge) {
+            ends.insert(ends.end(), lattice->faceVertices(edge), lattice->faceVertices(edge) + 2);
+        };
+        if (lattice->dimensions == 2) {
+            // the polygon itself is the only 2-face
+            for (int e = lattice->firstFace(1); e < lattice->firstFace(1) + lattice->faceCount(1); e++) {
+                addEdge(e);
+            }
+            appendCycle(ends, corners, used);
+            cornerOffsets.push_back((unsigned int)corners.size());
+        }
+        else {
+            for (int f = lattice->firstFace(2); f < lattice->firstFace(2) + lattice->faceCount(2); f++) {
+                ends.clear();
+                for (int k = 0; k < lattice->boundaryCount(f); k++) {
+                    addEdge((int)lattice->boundary(f)[k]);
+                }
+                appendCycle(ends, corners, used);
+                cornerOffsets.push_back((unsigned int)corners.size());
+            }
+        }
+    }
+
+    int faces = faceCount();
+    keys.resize(faces);
+    faceOrder.resize(faces);
+    world.resize((size_t)source.vertexCount * 3);
+    indices.clear();
+}
+
+void FilledFaces::update(const float* rotation, float scale, const glm::mat4& view) {
+    if (object == nullptr || faceCount() == 0) {
+        return;
+    }
+    transformVertices(rotation, dims, scale, object->vertices, object->vertexCount, world.data());
+
+    // view-space z of each centroid; the camera looks down -z, so ascending z is back to front
+    int faces = faceCount();
+    for (int f = 0; f < faces; f++) {
+        float centroid[3] = { 0.0f, 0.0f, 0.0f };
+        for (unsigned int c = cornerOffsets[f]; c < cornerOffsets[f + 1]; c++) {
+            const float* p = &world[(size_t)corners[c] * 3];
+            centroid[0] += p[0];
+            centroid[1] += p[1];
+            centroid[2] += p[2];
+        }
+        float depth = (view[0][2] * centroid[0] + view[1][2] * centroid[1] + view[2][2] * centroid[2])
+                    / (float)(cornerOffsets[f + 1] - cornerOffsets[f]) + view[3][2];
+        keys[f] = floatSortKey(depth);
+        faceOrder[f] = (uint32_t)f;
+    }
+    radixSortPairs(keys, faceOrder, sortScratch);
+
+    // fan triangulation of each (convex) face, in sorted order
+    indices.clear();
+    for (uint32_t f : faceOrder) {
+        unsigned int first = cornerOffsets[f];
+        for (unsigned int c = first + 1; c + 1 < cornerOffsets[f + 1]; c++) {
+            indices.push_back(corners[first]);
+            indices.push_back(corners[c]);
+            indices.push_back(corners[c + 1]);
+        }
+    }
+}
+
+void FilledFaces::draw(Shader& shader, float opacity, bool blend) {
+    if (indices.empty()) {
+        return;
+    }
+    shader.setFloat("positionScale", 1.0f);
+    glBindVertexArray(VAO);
+
+    // same attribute layout as NDimObjectData with Float32 storage
+    if (verticesDirty) {
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, object->vertexDataSize, object->vertices, GL_STATIC_DRAW);
+        setupVertexAttributes(dims, VERTEX_FORMAT_FLOAT32, (MAX_PROJECTION_DIMENSIONS + 3) / 4);
+        verticesDirty = false;
+    }
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STREAM_DRAW);
+
+    // the shaders write alpha 1, so the opacity comes in as the blend constant
+    if (blend) {
+        glEnable(GL_BLEND);
+        glBlendColor(0.0f, 0.0f, 0.0f, opacity);
+        glBlendFunc(GL_CONSTANT_ALPHA, GL_ONE_MINUS_CONSTANT_ALPHA);
+        glDepthMask(GL_FALSE);
+    }
+    glDrawElements(GL_TRIANGLES, (GLsizei)indices.size(), GL_UNSIGNED_INT, (void*)0);
+    if (blend) {
+        glDepthMask(GL_TRUE);
+        glDisable(GL_BLEND);
+    }
+    glBindVertexArray(0);
+}
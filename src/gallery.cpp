@@ -0,0 +1,181 @@
+#include "gallery.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include "edge_strips.h"
+#include "trace.h"
+
+namespace {
+
+// GalleryObjects layout in floats: cells, params, then 16 vec4 of rotation per object
+const int BLOCK_CELLS = 0;
+const int BLOCK_PARAMS = BLOCK_CELLS + MAX_GALLERY_OBJECTS * 4;
+const int BLOCK_ROTATIONS = BLOCK_PARAMS + MAX_GALLERY_OBJECTS * 4;
+const int BLOCK_FLOATS = BLOCK_ROTATIONS + MAX_GALLERY_OBJECTS * 64;
+const unsigned int BLOCK_BINDING = 0;
+
+} // namespace
+
+void Gallery::init() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &objectIndexBuffer);
+    glGenBuffers(1, &vertexBuffer);
+    glGenTextures(1, &vertexTexture);
+    glGenBuffers(1, &EBO);
+    glGenBuffers(1, &UBO);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, objectIndexBuffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribIPointer(0, 1, GL_UNSIGNED_INT, sizeof(unsigned int), (void*)0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    blockData.assign(BLOCK_FLOATS, 0.0f);
+    glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+    glBufferData(GL_UNIFORM_BUFFER, blockData.size() * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    entries.clear();
+}
+
+void Gallery::cleanup() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &objectIndexBuffer);
+    glDeleteBuffers(1, &vertexBuffer);
+    glDeleteTextures(1, &vertexTexture);
+    glDeleteBuffers(1, &EBO);
+    glDeleteBuffers(1, &UBO);
+    VAO = objectIndexBuffer = vertexBuffer = vertexTexture = EBO = UBO = 0;
+    entries.clear();
+}
+
+void Gallery::setObjects(const ObjectMap& objects) {
+    std::vector<Entry> current;
+    for (const auto& item : objects) {
+        const NDimObjectData* object = item.second;
+        if (object->dimensions > MAX_GALLERY_DIMENSIONS || object->vertexCount == 0) {
+            continue;
+        }
+        if ((int)current.size() == MAX_GALLERY_OBJECTS) {
+            std::cout << "ERROR::GALLERY::TOO_MANY_OBJECTS" << std::endl;
+            break;
+        }
+        current.push_back({ object, object->geometryGeneration });
+    }
+    bool unchanged = current.size() == entries.size() && std::equal(current.begin(), current.end(), entries.begin(),
+        [](const Entry& a, const Entry& b) { return a.object == b.object && a.geometryGeneration == b.geometryGeneration; });
+    if (unchanged) {
+        return;
+    }
+    TraceScope trace("Gallery upload", "gl");
+    entries.swap(current);
+
+    // vertices padded to MAX_GALLERY_DIMENSIONS floats, so the vertex id alone finds them
+    std::vector<float> vertices;
+    std::vector<unsigned int> objectIndices;
+    std::vector<unsigned int> indices;
+    std::vector<unsigned int> strips;
+    vertexFirst.clear();
+    vertexCounts.clear();
+    stripOffsets.clear();
+    stripCounts.clear();
+    for (size_t o = 0; o < entries.size(); o++) {
+        const NDimObjectData& object = *entries[o].object;
+        unsigned int first = (unsigned int)objectIndices.size();
+        vertexFirst.push_back((GLint)first);
+        vertexCounts.push_back(object.vertexCount);
+        for (int v = 0; v < object.vertexCount; v++) {
+            const float* p = object.vertices + (size_t)v * object.dimensions;
+            vertices.insert(vertices.end(), p, p + object.dimensions);
+            vertices.resize(vertices.size() + MAX_GALLERY_DIMENSIONS - object.dimensions, 0.0f);
+            objectIndices.push_back((unsigned int)o);
+        }
+        if (object.renderEdges && object.edgeCount > 0) {
+            buildLineStrips(object.vertexCount, object.edges, object.edgeCount, strips);
+            stripOffsets.push_back((const void*)(indices.size() * sizeof(unsigned int)));
+            stripCounts.push_back((GLsizei)strips.size());
+            for (unsigned int index : strips) {
+                indices.push_back(index == STRIP_RESTART_INDEX ? index : index + first);
+            }
+        }
+    }
+
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, objectIndexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, objectIndices.size() * sizeof(unsigned int), objectIndices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(VAO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+}
+
+void Gallery::update(float sceneTime, int width, int height) {
+    int count = objectCount();
+    if (count == 0) {
+        return;
+    }
+    // as many columns as keep the cells close to square
+    float aspect = height > 0 ? (float)width / (float)height : 1.0f;
+    int columns = std::max(1, (int)std::ceil(std::sqrt(count * aspect)));
+    columns = std::min(columns, count);
+    int rows = (count + columns - 1) / columns;
+    float shrink = std::min(1.0f / columns, 1.0f / rows);
+
+    float rotation[MAX_GALLERY_DIMENSIONS * MAX_GALLERY_DIMENSIONS];
+    for (int o = 0; o < count; o++) {
+        const NDimObjectData& object = *entries[o].object;
+        float* cell = &blockData[BLOCK_CELLS + o * 4];
+        cell[0] = -1.0f + (2.0f * (o % columns) + 1.0f) / columns;
+        cell[1] = 1.0f - (2.0f * (o / columns) + 1.0f) / rows;
+        cell[2] = shrink;
+        float* params = &blockData[BLOCK_PARAMS + o * 4];
+        params[0] = (float)object.dimensions;
+        params[1] = object.scale;
+
+        // widen the NxN matrix to 8x8 rows
+        int n = object.dimensions;
+        object.buildRotationMatrix(rotation, sceneTime);
+        float* rows8 = &blockData[BLOCK_ROTATIONS + o * 64];
+        for (int i = 0; i < n; i++) {
+            std::copy(rotation + i * n, rotation + (i + 1) * n, rows8 + i * MAX_GALLERY_DIMENSIONS);
+        }
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, blockData.size() * sizeof(float), blockData.data());
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void Gallery::draw(Shader& shader) {
+    if (entries.empty()) {
+        return;
+    }
+    glUniformBlockBinding(shader.ID, glGetUniformBlockIndex(shader.ID, "GalleryObjects"), BLOCK_BINDING);
+    glBindBufferBase(GL_UNIFORM_BUFFER, BLOCK_BINDING, UBO);
+    shader.setInt("vertexTable", 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glBindVertexArray(VAO);
+
+    if (!stripCounts.empty()) {
+        glLineWidth(EDGE_THICKNESS);
+        glEnable(GL_PRIMITIVE_RESTART);
+        glPrimitiveRestartIndex(STRIP_RESTART_INDEX);
+        glMultiDrawElements(GL_LINE_STRIP, stripCounts.data(), GL_UNSIGNED_INT, stripOffsets.data(), (GLsizei)stripCounts.size());
+        glDisable(GL_PRIMITIVE_RESTART);
+    }
+    glPointSize(VERTEX_SIZE);
+    glMultiDrawArrays(GL_POINTS, vertexFirst.data(), vertexCounts.data(), (GLsizei)vertexCounts.size());
+
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
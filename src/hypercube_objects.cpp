@@ -1,5 +1,20 @@
-#include "ndim_object.h"
-#include "vertex_data.h"
+#include "hypercube_objects.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "face_lattice.h"
+#include "polytope_cache.h"
+#include "polytope_generators.h"
+#include "polytope_operators.h"
+#include "quickhull.h"
+#include "wythoff.h"
+#include "zonotope.h"
 
 static float identity2D[4];
 static float identity3D[9];
@@ -40,9 +55,9 @@ RotationPlane rotations_8D[] = {
 };
 
 NDimObjectData hypercube2D = {
-    hypercubeVerts_2D,           // vertices
-    hypercubeVerts_2D_size,      // vertexDataSize
-    8,                           // vertexCount (2D square has 4 vertices, 4 edges, 8 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     2,                           // dimensions
     rotations_2D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -57,9 +72,9 @@ NDimObjectData hypercube2D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData hypercube3D = {
-    hypercubeVerts_3D,           // vertices
-    hypercubeVerts_3D_size,      // vertexDataSize
-    24,                          // vertexCount (3D cube has 8 vertices, 12 edges, 24 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     3,                           // dimensions
     rotations_3D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -74,9 +89,9 @@ NDimObjectData hypercube3D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData hypercube4D = {
-    hypercubeVerts_4D,           // vertices
-    hypercubeVerts_4D_size,      // vertexDataSize
-    64,                          // vertexCount (4D hypercube has 16 vertices, 32 edges, 64 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     4,                           // dimensions
     rotations_4D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -91,9 +106,9 @@ NDimObjectData hypercube4D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData hypercube5D = {
-    hypercubeVerts_5D,           // vertices
-    hypercubeVerts_5D_size,      // vertexDataSize
-    160,                         // vertexCount (5D hypercube has 32 vertices, 80 edges, 160 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     5,                           // dimensions
     rotations_5D,       // defaultRotationPlanes
     2,                           // numRotationPlanes
@@ -108,9 +123,9 @@ NDimObjectData hypercube5D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData hypercube6D = {
-    hypercubeVerts_6D,           // vertices
-    hypercubeVerts_6D_size,      // vertexDataSize
-    384,                         // vertexCount (6D hypercube has 64 vertices, 192 edges, 384 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     6,                           // dimensions
     rotations_6D,       // defaultRotationPlanes
     3,                           // numRotationPlanes
@@ -125,9 +140,9 @@ NDimObjectData hypercube6D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData hypercube7D = {
-    hypercubeVerts_7D,           // vertices
-    hypercubeVerts_7D_size,      // vertexDataSize
-    896,                         // vertexCount (7D hypercube has 128 vertices, 448 edges, 896 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     7,                           // dimensions
     rotations_7D,       // defaultRotationPlanes
     3,                           // numRotationPlanes
@@ -142,9 +157,9 @@ NDimObjectData hypercube7D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData hypercube8D = {
-    hypercubeVerts_8D,           // vertices
-    hypercubeVerts_8D_size,      // vertexDataSize
-    2048,                        // vertexCount (8D hypercube has 256 vertices, 1024 edges, 2048 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     8,                           // dimensions
     rotations_8D,       // defaultRotationPlanes
     4,                           // numRotationPlanes
@@ -160,9 +175,9 @@ NDimObjectData hypercube8D = {
 };
 
 NDimObjectData simplex2D = {
-    simplexVerts_2D,           // vertices
-    simplexVerts_2D_size,      // vertexDataSize
-    6,                           // vertexCount (2D simplex/triangle has 3 vertices, 3 edges, 6 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     2,                           // dimensions
     rotations_2D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -177,9 +192,9 @@ NDimObjectData simplex2D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData simplex3D = {
-    simplexVerts_3D,           // vertices
-    simplexVerts_3D_size,      // vertexDataSize
-    12,                          // vertexCount (3D simplex has 4 vertices, 6 edges, 12 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     3,                           // dimensions
     rotations_3D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -194,9 +209,9 @@ NDimObjectData simplex3D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData simplex4D = {
-    simplexVerts_4D,           // vertices
-    simplexVerts_4D_size,      // vertexDataSize
-    20,                          // vertexCount (4D simplex has 5 vertices, 10 edges, 20 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     4,                           // dimensions
     rotations_4D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -211,9 +226,9 @@ NDimObjectData simplex4D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData simplex5D = {
-    simplexVerts_5D,           // vertices
-    simplexVerts_5D_size,      // vertexDataSize
-    30,                          // vertexCount (5D simplex has 6 vertices, 15 edges, 30 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     5,                           // dimensions
     rotations_5D,       // defaultRotationPlanes
     2,                           // numRotationPlanes
@@ -228,9 +243,9 @@ NDimObjectData simplex5D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData simplex6D = {
-    simplexVerts_6D,           // vertices
-    simplexVerts_6D_size,      // vertexDataSize
-    42,                          // vertexCount (6D simplex has 7 vertices, 21 edges, 42 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     6,                           // dimensions
     rotations_6D,       // defaultRotationPlanes
     3,                           // numRotationPlanes
@@ -245,9 +260,9 @@ NDimObjectData simplex6D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData simplex7D = {
-    simplexVerts_7D,           // vertices
-    simplexVerts_7D_size,      // vertexDataSize
-    56,                          // vertexCount (7D simplex has 8 vertices, 28 edges, 56 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     7,                           // dimensions
     rotations_7D,       // defaultRotationPlanes
     3,                           // numRotationPlanes
@@ -262,9 +277,9 @@ NDimObjectData simplex7D = {
     "shaders/ws-coloring.f"         // shaderFragPath
 };
 NDimObjectData simplex8D = {
-    simplexVerts_8D,           // vertices
-    simplexVerts_8D_size,      // vertexDataSize
-    72,                          // vertexCount (8D simplex has 9 vertices, 36 edges, 72 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     8,                           // dimensions
     rotations_8D,       // defaultRotationPlanes
     4,                           // numRotationPlanes
@@ -280,9 +295,9 @@ NDimObjectData simplex8D = {
 };
 
 NDimObjectData crossPolytope2D = {
-    crossPolytopeVerts_2D,       // vertices
-    crossPolytopeVerts_2D_size,  // vertexDataSize
-    8,                           // vertexCount (2D cross-polytope has 4 vertices, 4 edges, 8 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     2,                           // dimensions
     rotations_2D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -297,9 +312,9 @@ NDimObjectData crossPolytope2D = {
     "shaders/ws-coloring.f"      // shaderFragPath
 };
 NDimObjectData crossPolytope3D = {
-    crossPolytopeVerts_3D,       // vertices
-    crossPolytopeVerts_3D_size,  // vertexDataSize
-    24,                          // vertexCount (3D cross-polytope has 6 vertices, 12 edges, 24 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     3,                           // dimensions
     rotations_3D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -314,9 +329,9 @@ NDimObjectData crossPolytope3D = {
     "shaders/ws-coloring.f"      // shaderFragPath
 };
 NDimObjectData crossPolytope4D = {
-    crossPolytopeVerts_4D,       // vertices
-    crossPolytopeVerts_4D_size,  // vertexDataSize
-    48,                          // vertexCount (4D cross-polytope has 8 vertices, 24 edges, 48 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     4,                           // dimensions
     rotations_4D,       // defaultRotationPlanes
     1,                           // numRotationPlanes
@@ -331,9 +346,9 @@ NDimObjectData crossPolytope4D = {
     "shaders/ws-coloring.f"      // shaderFragPath
 };
 NDimObjectData crossPolytope5D = {
-    crossPolytopeVerts_5D,       // vertices
-    crossPolytopeVerts_5D_size,  // vertexDataSize
-    80,                          // vertexCount (5D cross-polytope has 10 vertices, 40 edges, 80 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     5,                           // dimensions
     rotations_5D,       // defaultRotationPlanes
     2,                           // numRotationPlanes
@@ -348,9 +363,9 @@ NDimObjectData crossPolytope5D = {
     "shaders/ws-coloring.f"      // shaderFragPath
 };
 NDimObjectData crossPolytope6D = {
-    crossPolytopeVerts_6D,       // vertices
-    crossPolytopeVerts_6D_size,  // vertexDataSize
-    132,                         // vertexCount (6D cross-polytope has 12 vertices, 66 edges, 132 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     6,                           // dimensions
     rotations_6D,       // defaultRotationPlanes
     3,                           // numRotationPlanes
@@ -365,9 +380,9 @@ NDimObjectData crossPolytope6D = {
     "shaders/ws-coloring.f"      // shaderFragPath
 };
 NDimObjectData crossPolytope7D = {
-    crossPolytopeVerts_7D,       // vertices
-    crossPolytopeVerts_7D_size,  // vertexDataSize
-    196,                         // vertexCount (7D cross-polytope has 14 vertices, 98 edges, 196 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     7,                           // dimensions
     rotations_7D,       // defaultRotationPlanes
     3,                           // numRotationPlanes
@@ -382,9 +397,9 @@ NDimObjectData crossPolytope7D = {
     "shaders/ws-coloring.f"      // shaderFragPath
 };
 NDimObjectData crossPolytope8D = {
-    crossPolytopeVerts_8D,       // vertices
-    crossPolytopeVerts_8D_size,  // vertexDataSize
-    272,                         // vertexCount (8D cross-polytope has 16 vertices, 136 edges, 272 vertices for GL_LINES)
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
     8,                           // dimensions
     rotations_8D,       // defaultRotationPlanes
     4,                           // numRotationPlanes
@@ -398,3 +413,610 @@ NDimObjectData crossPolytope8D = {
     "shaders/8d.v",              // shaderVertPath
     "shaders/ws-coloring.f"      // shaderFragPath
 };
+
+// Uniform polytopes from the Wythoff construction (circumradius 1, like the cross-polytopes)
+NDimObjectData cell24 = {
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
+    4,                           // dimensions
+    rotations_4D,       // defaultRotationPlanes
+    1,                           // numRotationPlanes
+    identity4D,                  // identityMatrix (will be initialized)
+    3.5f,                        // scale
+    true,                        // renderEdges
+    0,                           // VAO (will be set by setupBuffers)
+    0,                           // VBO (will be set by setupBuffers)
+    nullptr,                     // shader (will be initialized by initShader)
+    "24-Cell",                   // name
+    "shaders/4d.v",              // shaderVertPath
+    "shaders/ws-coloring.f"      // shaderFragPath
+};
+NDimObjectData cell120 = {
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
+    4,                           // dimensions
+    rotations_4D,       // defaultRotationPlanes
+    1,                           // numRotationPlanes
+    identity4D,                  // identityMatrix (will be initialized)
+    3.5f,                        // scale
+    true,                        // renderEdges
+    0,                           // VAO (will be set by setupBuffers)
+    0,                           // VBO (will be set by setupBuffers)
+    nullptr,                     // shader (will be initialized by initShader)
+    "120-Cell",                  // name
+    "shaders/4d.v",              // shaderVertPath
+    "shaders/ws-coloring.f"      // shaderFragPath
+};
+NDimObjectData cell600 = {
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
+    4,                           // dimensions
+    rotations_4D,       // defaultRotationPlanes
+    1,                           // numRotationPlanes
+    identity4D,                  // identityMatrix (will be initialized)
+    3.5f,                        // scale
+    true,                        // renderEdges
+    0,                           // VAO (will be set by setupBuffers)
+    0,                           // VBO (will be set by setupBuffers)
+    nullptr,                     // shader (will be initialized by initShader)
+    "600-Cell",                  // name
+    "shaders/4d.v",              // shaderVertPath
+    "shaders/ws-coloring.f"      // shaderFragPath
+};
+NDimObjectData gosset421 = {
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
+    8,                           // dimensions
+    rotations_8D,       // defaultRotationPlanes
+    4,                           // numRotationPlanes
+    identity8D,                  // identityMatrix (will be initialized)
+    300.0f,                      // scale
+    true,                        // renderEdges
+    0,                           // VAO (will be set by setupBuffers)
+    0,                           // VBO (will be set by setupBuffers)
+    nullptr,                     // shader (will be initialized by initShader)
+    "E8 Polytope (4_21)",        // name
+    "shaders/8d.v",              // shaderVertPath
+    "shaders/ws-coloring.f"      // shaderFragPath
+};
+
+// Convex hull of a point set; 4D random points unless --points gives a file
+NDimObjectData pointHull = {
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
+    4,                           // dimensions (replaced by the point set's)
+    rotations_4D,       // defaultRotationPlanes
+    1,                           // numRotationPlanes
+    identity4D,                  // identityMatrix (will be initialized)
+    3.5f,                        // scale (the hull is normalized to a unit circumradius)
+    true,                        // renderEdges
+    0,                           // VAO (will be set by setupBuffers)
+    0,                           // VBO (will be set by setupBuffers)
+    nullptr,                     // shader (will be initialized by initShader)
+    "Point Hull",                // name
+    "shaders/4d.v",              // shaderVertPath
+    "shaders/ws-coloring.f"      // shaderFragPath
+};
+
+// p-gon x q-gon, both on the unit circle (circumradius sqrt 2); sides set by setDuoprismSides
+NDimObjectData duoprism = {
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
+    4,                           // dimensions
+    rotations_4D,       // defaultRotationPlanes
+    1,                           // numRotationPlanes
+    identity4D,                  // identityMatrix (will be initialized)
+    2.5f,                        // scale
+    true,                        // renderEdges
+    0,                           // VAO (will be set by setupBuffers)
+    0,                           // VBO (will be set by setupBuffers)
+    nullptr,                     // shader (will be initialized by initShader)
+    "Duoprism",                  // name
+    "shaders/4d.v",              // shaderVertPath
+    "shaders/ws-coloring.f"      // shaderFragPath
+};
+
+// Sum of segments along generator vectors; cyclic 4D generators unless --zonotope gives a file
+NDimObjectData zonotope = {
+    nullptr,                     // vertices (mapped from the polytope cache by populateObjectMap)
+    0,                           // vertexDataSize
+    0,                           // vertexCount
+    4,                           // dimensions (replaced by the generator file's)
+    rotations_4D,       // defaultRotationPlanes
+    1,                           // numRotationPlanes
+    identity4D,                  // identityMatrix (will be initialized)
+    3.5f,                        // scale (the zonotope is normalized to a unit circumradius)
+    true,                        // renderEdges
+    0,                           // VAO (will be set by setupBuffers)
+    0,                           // VBO (will be set by setupBuffers)
+    nullptr,                     // shader (will be initialized by initShader)
+    "Zonotope",                  // name
+    "shaders/4d.v",              // shaderVertPath
+    "shaders/ws-coloring.f"      // shaderFragPath
+};
+
+// Bump when a generator's output changes, so stale cache files are regenerated
+static const char* const GENERATOR_VERSION = "v4";
+
+// Keeps the cache mappings alive for as long as the objects point into them;
+// reloading an object's geometry releases its previous mapping
+static std::map<const NDimObjectData*, std::unique_ptr<PolytopeCacheFile>> loadedGeometry;
+// Lattices are deserialized by loadLattice on first use; an entry (possibly empty) marks the attempt
+static std::map<const NDimObjectData*, std::unique_ptr<FaceLattice>> loadedLattices;
+static std::map<const NDimObjectData*, int> loadedShapeTypes;
+
+// Coxeter diagram and ring pattern of each Wythoff shape type (3 and up)
+struct WythoffShape {
+    const char* family;
+    const char* diagram;
+    const char* rings;
+    bool latticeOnDemand;   // hull and lattice too slow to build up front: cached separately by loadLattice
+};
+static const WythoffShape wythoffShapes[] = {
+    { "24-cell", "3 4 3", "xooo", false },
+    { "120-cell", "5 3 3", "xooo", false },
+    { "600-cell", "3 3 5", "xooo", false },
+    { "4_21", "E8", "xooooooo", true }
+};
+
+// The orbit gives vertices and edges only; its hull supplies the facets (every orbit point
+// is extreme, and the hull keeps them in input order)
+static void generateWythoffShape(const WythoffShape& shape, bool facets, PolytopeMesh& mesh) {
+    CoxeterDiagram diagram;
+    if (!parseCoxeterDiagram(shape.diagram, diagram) || !generateWythoff(diagram, shape.rings, mesh)) {
+        return;
+    }
+    if (!facets) {
+        return;
+    }
+    PolytopeMesh hull;
+    if (computeConvexHull(mesh.vertices.data(), mesh.vertexCount(), mesh.dimensions, hull) && hull.vertexCount() == mesh.vertexCount()) {
+        mesh.facetOffsets.swap(hull.facetOffsets);
+        mesh.facetVertices.swap(hull.facetVertices);
+    }
+}
+
+// Cache entry of a Wythoff shape; with facets, the cache also builds and stores its lattice
+static std::unique_ptr<PolytopeCacheFile> loadWythoffShape(const WythoffShape& shape, int dims, bool facets) {
+    std::string params = std::string(GENERATOR_VERSION) + " " + shape.diagram + " " + shape.rings + (facets ? "" : " no-facets");
+    return loadOrGeneratePolytope(shape.family, dims, params,
+        [&shape, facets](PolytopeMesh& mesh) { generateWythoffShape(shape, facets, mesh); });
+}
+
+static std::string pointSetPath;
+static const int HULL_SPHERE_POINTS = 64;
+static std::string zonotopeGeneratorPath;
+static int zonotopeGeneratorCount = 12;
+
+void parsePointSetArgs(int& argc, char** argv) {
+    int out = 1;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--points" && i + 1 < argc) {
+            pointSetPath = argv[++i];
+        }
+        else if (std::string(argv[i]) == "--zonotope" && i + 1 < argc) {
+            zonotopeGeneratorPath = argv[++i];
+        }
+        else {
+            argv[out++] = argv[i];
+        }
+    }
+    argc = out;
+}
+
+// Point the object at the per-dimension rotation planes, identity buffer and shader,
+// with the cross-polytope scale for a unit circumradius
+static void setObjectDimensions(NDimObjectData& object, int dims) {
+    static const RotationPlane* const planes[] = { rotations_2D, rotations_3D, rotations_4D, rotations_5D, rotations_6D, rotations_7D, rotations_8D };
+    static const int planeCounts[] = { 1, 1, 1, 2, 3, 3, 4 };
+    static float* const identities[] = { identity2D, identity3D, identity4D, identity5D, identity6D, identity7D, identity8D };
+    static const char* const shaders[] = { "shaders/2d.v", "shaders/3d.v", "shaders/4d.v", "shaders/5d.v", "shaders/6d.v", "shaders/7d.v", "shaders/8d.v" };
+    static const float scales[] = { 1.0f, 1.2f, 3.5f, 8.0f, 30.0f, 120.0f, 300.0f };
+
+    object.dimensions = dims;
+    object.defaultRotationPlanes = planes[dims - 2];
+    object.numRotationPlanes = planeCounts[dims - 2];
+    object.identityMatrix = identities[dims - 2];
+    object.shaderVertPath = shaders[dims - 2];
+    object.scale = scales[dims - 2];
+}
+
+static int duoprismSides[2] = { 5, 7 };
+
+static void generateDuoprism(int p, int q, PolytopeMesh& mesh) {
+    PolytopeMesh a;
+    PolytopeMesh b;
+    generatePolygon(p, a);
+    generatePolygon(q, b);
+    productPolytope(a, b, mesh);
+}
+
+// Largest distance of a vertex from the origin
+static float circumradius(const float* vertices, int vertexCount, int dims) {
+    float radius = 0.0f;
+    for (int v = 0; v < vertexCount; v++) {
+        float r = 0.0f;
+        for (int i = 0; i < dims; i++) {
+            r += vertices[v * dims + i] * vertices[v * dims + i];
+        }
+        radius = std::max(radius, std::sqrt(r));
+    }
+    return radius;
+}
+
+// Rescale to a unit circumradius: the 4D+ shaders divide by (distance + w) before applying
+// the object's scale, so vertices must already be near the unit sphere
+static void normalizeCircumradius(PolytopeMesh& mesh) {
+    float radius = circumradius(mesh.vertices.data(), mesh.vertexCount(), mesh.dimensions);
+    if (radius > 0.0f) {
+        for (float& x : mesh.vertices) {
+            x /= radius;
+        }
+    }
+}
+
+static std::unique_ptr<PolytopeCacheFile> loadPointHull(NDimObjectData& object) {
+    int dims = 0;
+    std::vector<float> points;
+    if (!pointSetPath.empty() && loadPointSet(pointSetPath, dims, points) && (dims < 2 || dims > 8)) {
+        std::cout << "ERROR::POINT_SET::UNSUPPORTED_DIMENSIONS " << dims << std::endl;
+        points.clear();
+    }
+    if (points.empty()) {
+        dims = 4;
+        generateSpherePoints(dims, HULL_SPHERE_POINTS, 1, points);
+    }
+    setObjectDimensions(object, dims);
+
+    char hash[32];
+    snprintf(hash, sizeof(hash), " %016llx", (unsigned long long)fnv1a64(points.data(), points.size() * sizeof(float)));
+    int pointCount = (int)(points.size() / dims);
+    return loadOrGeneratePolytope("point-hull", dims, std::string(GENERATOR_VERSION) + hash,
+        [&points, pointCount, dims](PolytopeMesh& mesh) {
+            computeConvexHull(points.data(), pointCount, dims, mesh);
+            normalizeCircumradius(mesh);
+        });
+}
+
+static std::unique_ptr<PolytopeCacheFile> loadZonotope(NDimObjectData& object) {
+    int dims = 0;
+    std::vector<float> generators;
+    if (!zonotopeGeneratorPath.empty() && loadPointSet(zonotopeGeneratorPath, dims, generators) && (dims < 2 || dims > 8)) {
+        std::cout << "ERROR::ZONOTOPE::UNSUPPORTED_DIMENSIONS " << dims << std::endl;
+        generators.clear();
+    }
+    if (generators.empty()) {
+        dims = 4;
+        generateCyclicGenerators(zonotopeGeneratorCount, dims, generators);
+    }
+    setObjectDimensions(object, dims);
+
+    char hash[32];
+    snprintf(hash, sizeof(hash), " %016llx", (unsigned long long)fnv1a64(generators.data(), generators.size() * sizeof(float)));
+    int generatorCount = (int)(generators.size() / dims);
+    return loadOrGeneratePolytope("zonotope", dims, std::string(GENERATOR_VERSION) + hash,
+        [&generators, generatorCount, dims](PolytopeMesh& mesh) {
+            generateZonotope(generators.data(), generatorCount, dims, mesh);
+            normalizeCircumradius(mesh);
+        });
+}
+
+// The object's cache file for its current parameters; has no vertices if it failed to load
+static std::unique_ptr<PolytopeCacheFile> loadGeometryFile(int shapeType, NDimObjectData& object) {
+    static const char* const familyNames[] = { "hypercube", "simplex", "cross-polytope" };
+    static void (*const generators[])(int, PolytopeMesh&) = { generateHypercube, generateSimplex, generateCrossPolytope };
+
+    int dims = object.dimensions;
+    std::unique_ptr<PolytopeCacheFile> file;
+    if (shapeType == 7) {
+        file = loadPointHull(object);
+        dims = object.dimensions;
+    }
+    else if (shapeType == 9) {
+        file = loadZonotope(object);
+        dims = object.dimensions;
+    }
+    else if (shapeType == 8) {
+        int p = duoprismSides[0];
+        int q = duoprismSides[1];
+        file = loadOrGeneratePolytope("duoprism", dims, std::string(GENERATOR_VERSION) + " " + std::to_string(p) + " " + std::to_string(q),
+            [p, q](PolytopeMesh& mesh) { generateDuoprism(p, q, mesh); });
+    }
+    else if (shapeType < 3) {
+        file = loadOrGeneratePolytope(familyNames[shapeType], dims, GENERATOR_VERSION,
+            [shapeType, dims](PolytopeMesh& mesh) { generators[shapeType](dims, mesh); });
+    }
+    else {
+        const WythoffShape& shape = wythoffShapes[shapeType - 3];
+        file = loadWythoffShape(shape, dims, !shape.latticeOnDemand);
+    }
+    return file;
+}
+
+static void setGeometry(int shapeType, NDimObjectData& object, std::unique_ptr<PolytopeCacheFile> file) {
+    int dims = object.dimensions;
+    object.vertices = file->vertices();
+    object.vertexDataSize = file->vertexBytes();
+    object.vertexCount = file->vertexCount();
+    object.edges = file->edges();
+    object.edgeCount = file->edgeCount();
+    object.circumradius = circumradius(object.vertices, object.vertexCount, dims);
+    object.geometryGeneration++;
+    loadedGeometry[&object] = std::move(file);
+    loadedShapeTypes[&object] = shapeType;
+}
+
+static void loadGeometry(int shapeType, NDimObjectData& object) {
+    if (object.vertices != nullptr) {
+        return;
+    }
+    std::unique_ptr<PolytopeCacheFile> file = loadGeometryFile(shapeType, object);
+    if (file->vertexCount() > 0) {
+        setGeometry(shapeType, object, std::move(file));
+    }
+}
+
+// Replace the object's geometry after its parameters changed. The old mesh, file and lattice
+// are only dropped once the new file has loaded, so a failure leaves the object as it was.
+static bool reloadGeometry(int shapeType, NDimObjectData& object) {
+    std::unique_ptr<PolytopeCacheFile> file = loadGeometryFile(shapeType, object);
+    if (file->vertexCount() == 0) {
+        std::cout << "ERROR::GEOMETRY::RELOAD_FAILED " << object.name << std::endl;
+        return false;
+    }
+    object.lattice = nullptr;
+    loadedLattices.erase(&object);
+    setGeometry(shapeType, object, std::move(file));
+    return true;
+}
+
+const FaceLattice* loadLattice(NDimObjectData& object) {
+    auto loaded = loadedLattices.find(&object);
+    if (loaded != loadedLattices.end()) {
+        return loaded->second.get();
+    }
+    auto geometry = loadedGeometry.find(&object);
+    if (object.lattice != nullptr || geometry == loadedGeometry.end()) {
+        return object.lattice;  // derived objects come with theirs
+    }
+    TraceScope trace("Load lattice", "geometry");
+    std::unique_ptr<FaceLattice>& lattice = loadedLattices[&object];
+    const PolytopeCacheFile* file = geometry->second.get();
+
+    // same orbit and vertex order as the geometry file, plus facets and lattice; only the
+    // deserialized lattice is kept
+    std::unique_ptr<PolytopeCacheFile> facetFile;
+    int shapeType = loadedShapeTypes[&object];
+    if (shapeType >= 3 && shapeType < 7 && wythoffShapes[shapeType - 3].latticeOnDemand) {
+        facetFile = loadWythoffShape(wythoffShapes[shapeType - 3], object.dimensions, true);
+        if (facetFile->vertexCount() != object.vertexCount) {
+            std::cout << "ERROR::LATTICE::VERTEX_MISMATCH " << object.name << std::endl;
+            return nullptr;
+        }
+        file = facetFile.get();
+    }
+
+    lattice.reset(new FaceLattice());
+    if (!deserializeFaceLattice(file->lattice(), file->latticeWords(), file->vertexCount(), *lattice)) {
+        lattice.reset();
+        return nullptr;
+    }
+    object.lattice = lattice.get();
+    object.geometryGeneration++;
+    return object.lattice;
+}
+
+void getDuoprismSides(int& p, int& q) {
+    p = duoprismSides[0];
+    q = duoprismSides[1];
+}
+
+void setDuoprismSides(int p, int q) {
+    p = std::min(std::max(p, 3), DUOPRISM_MAX_SIDES);
+    q = std::min(std::max(q, 3), DUOPRISM_MAX_SIDES);
+    if (p == duoprismSides[0] && q == duoprismSides[1] && duoprism.vertices != nullptr) {
+        return;
+    }
+    int previous[2] = { duoprismSides[0], duoprismSides[1] };
+    duoprismSides[0] = p;
+    duoprismSides[1] = q;
+    if (!reloadGeometry(8, duoprism)) {
+        duoprismSides[0] = previous[0];
+        duoprismSides[1] = previous[1];
+    }
+}
+
+int getZonotopeGeneratorCount() {
+    return zonotopeGeneratorCount;
+}
+
+bool zonotopeGeneratorsFromFile() {
+    return !zonotopeGeneratorPath.empty();
+}
+
+void setZonotopeGeneratorCount(int count) {
+    count = std::min(std::max(count, 1), ZONOTOPE_MAX_GENERATORS);
+    if (count == zonotopeGeneratorCount && zonotope.vertices != nullptr) {
+        return;
+    }
+    int previous = zonotopeGeneratorCount;
+    zonotopeGeneratorCount = count;
+    if (zonotopeGeneratorsFromFile()) {
+        return;
+    }
+    if (!reloadGeometry(9, zonotope)) {
+        zonotopeGeneratorCount = previous;
+    }
+}
+
+// Object derived from another object's lattice: its dual, or the result of an operator.
+// Rebuilt in place when the source's geometry is reloaded, so pointers to it stay valid
+// (the dual of an operated object is keyed by the operated object's address).
+struct DerivedObject {
+    unsigned int sourceGeneration = 0;        // source geometry it was built from, 0 until built and initialized
+    PolytopeMesh mesh;                        // dual geometry
+    std::unique_ptr<PolytopeCacheFile> file;  // operator geometry, from the polytope cache
+    FaceLattice lattice;
+    std::string name;
+    NDimObjectData object;
+};
+static const int DERIVED_DUAL = -1;  // other kinds are PolytopeOperator values
+static std::map<std::pair<const NDimObjectData*, int>, std::unique_ptr<DerivedObject>> derivedObjects;
+
+// Slot for (source, kind), emptied for a rebuild; nullptr when it is already current
+static DerivedObject* staleDerivedObject(const NDimObjectData& source, int kind) {
+    std::unique_ptr<DerivedObject>& derived = derivedObjects[std::make_pair(&source, kind)];
+    if (!derived) {
+        derived.reset(new DerivedObject());
+        return derived.get();
+    }
+    if (derived->sourceGeneration == source.geometryGeneration) {
+        return nullptr;
+    }
+    if (derived->sourceGeneration != 0) {
+        derived->object.cleanup();
+    }
+    derived->sourceGeneration = 0;
+    derived->mesh = PolytopeMesh();
+    derived->file.reset();
+    derived->lattice = FaceLattice();
+    return derived.get();
+}
+
+static NDimObjectData* currentDerivedObject(const NDimObjectData& source, int kind) {
+    DerivedObject* derived = derivedObjects[std::make_pair(&source, kind)].get();
+    return derived->sourceGeneration != 0 ? &derived->object : nullptr;
+}
+
+// Same rotation, shaders and vertex format as the source, drawn at the source's size
+static void initDerivedObject(const NDimObjectData& source, DerivedObject& derived, const float* vertices, int vertexCount,
+                              const unsigned int* edges, int edgeCount, bool hasLattice) {
+    NDimObjectData& data = derived.object;
+    unsigned int generation = data.geometryGeneration;
+    data = source;
+    data.geometryGeneration = generation + 1;
+    data.vertices = vertices;
+    data.vertexDataSize = (size_t)vertexCount * source.dimensions * sizeof(float);
+    data.vertexCount = vertexCount;
+    data.edges = edges;
+    data.edgeCount = edgeCount;
+    data.lattice = hasLattice ? &derived.lattice : nullptr;
+    data.name = derived.name.c_str();
+    data.VAO = 0;
+    data.VBO = 0;
+    data.EBO = 0;
+    data.shader = nullptr;
+    data.circumradius = circumradius(vertices, vertexCount, source.dimensions);
+    if (data.circumradius > 0.0f) {
+        data.scale *= source.circumradius / data.circumradius;
+    }
+    data.init();
+    derived.sourceGeneration = source.geometryGeneration;
+}
+
+NDimObjectData* dualObject(NDimObjectData& object) {
+    if (loadLattice(object) == nullptr) {
+        return nullptr;
+    }
+    DerivedObject* dual = staleDerivedObject(object, DERIVED_DUAL);
+    if (dual == nullptr) {
+        return currentDerivedObject(object, DERIVED_DUAL);
+    }
+    if (!dualPolytope(object.vertices, object.dimensions, *object.lattice, dual->mesh)) {
+        return nullptr;
+    }
+    dualFaceLattice(*object.lattice, dual->lattice);
+    dual->name = std::string("Dual of ") + object.name;
+    initDerivedObject(object, *dual, dual->mesh.vertices.data(), dual->mesh.vertexCount(),
+        dual->mesh.edges.data(), dual->mesh.edgeCount(), true);
+    return &dual->object;
+}
+
+NDimObjectData* operatedObject(NDimObjectData& object, PolytopeOperator op) {
+    if (loadLattice(object) == nullptr) {
+        return nullptr;
+    }
+    DerivedObject* operated = staleDerivedObject(object, op);
+    if (operated == nullptr) {
+        return currentDerivedObject(object, op);
+    }
+
+    // cached per operator and source geometry; the cache builds the result's lattice
+    const float* vertices = object.vertices;
+    int dims = object.dimensions;
+    const FaceLattice& lattice = *object.lattice;
+    char hash[32];
+    snprintf(hash, sizeof(hash), " %016llx", (unsigned long long)fnv1a64(vertices, (size_t)object.vertexCount * dims * sizeof(float)));
+    operated->file = loadOrGeneratePolytope(polytopeOperatorName(op), dims, std::string(GENERATOR_VERSION) + hash,
+        [vertices, dims, &lattice, op](PolytopeMesh& mesh) { applyPolytopeOperator(op, vertices, dims, lattice, mesh); });
+    PolytopeCacheFile& file = *operated->file;
+    if (file.vertexCount() == 0) {
+        return nullptr;
+    }
+
+    static const char* const prefixes[OPERATOR_COUNT] = { "Truncated ", "Rectified ", "Bitruncated ", "Cantellated " };
+    operated->name = std::string(prefixes[op]) + object.name;
+    bool hasLattice = deserializeFaceLattice(file.lattice(), file.latticeWords(), file.vertexCount(), operated->lattice);
+    initDerivedObject(object, *operated, file.vertices(), file.vertexCount(), file.edges(), file.edgeCount(), hasLattice);
+    return &operated->object;
+}
+
+void cleanupDerivedObjects() {
+    for (auto& entry : derivedObjects) {
+        if (entry.second->sourceGeneration != 0) {
+            entry.second->object.cleanup();
+        }
+    }
+    derivedObjects.clear();
+}
+
+// Shape types: 0 = Hypercube, 1 = Simplex, 2 = Cross-Polytope,
+// 3 = 24-Cell, 4 = 120-Cell, 5 = 600-Cell, 6 = E8 polytope 4_21, 7 = Point Hull, 8 = Duoprism,
+// 9 = Zonotope
+void populateObjectMap(ObjectMap& objectMap) {
+    objectMap[{0, 2}] = &hypercube2D;
+    objectMap[{0, 3}] = &hypercube3D;
+    objectMap[{0, 4}] = &hypercube4D;
+    objectMap[{0, 5}] = &hypercube5D;
+    objectMap[{0, 6}] = &hypercube6D;
+    objectMap[{0, 7}] = &hypercube7D;
+    objectMap[{0, 8}] = &hypercube8D;
+
+    objectMap[{1, 2}] = &simplex2D;
+    objectMap[{1, 3}] = &simplex3D;
+    objectMap[{1, 4}] = &simplex4D;
+    objectMap[{1, 5}] = &simplex5D;
+    objectMap[{1, 6}] = &simplex6D;
+    objectMap[{1, 7}] = &simplex7D;
+    objectMap[{1, 8}] = &simplex8D;
+
+    objectMap[{2, 2}] = &crossPolytope2D;
+    objectMap[{2, 3}] = &crossPolytope3D;
+    objectMap[{2, 4}] = &crossPolytope4D;
+    objectMap[{2, 5}] = &crossPolytope5D;
+    objectMap[{2, 6}] = &crossPolytope6D;
+    objectMap[{2, 7}] = &crossPolytope7D;
+    objectMap[{2, 8}] = &crossPolytope8D;
+
+    objectMap[{3, 4}] = &cell24;
+    objectMap[{4, 4}] = &cell120;
+    objectMap[{5, 4}] = &cell600;
+    objectMap[{6, 8}] = &gosset421;
+    objectMap[{8, 4}] = &duoprism;
+
+    // the hull's and zonotope's dimensions come from their input files, so load them before keying them
+    loadGeometry(7, pointHull);
+    objectMap[{7, pointHull.dimensions}] = &pointHull;
+    loadGeometry(9, zonotope);
+    objectMap[{9, zonotope.dimensions}] = &zonotope;
+
+    for (auto& entry : objectMap) {
+        loadGeometry(entry.first.first, *entry.second);
+    }
+}
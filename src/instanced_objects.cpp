@@ -0,0 +1,147 @@
+#include "instanced_objects.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include "edge_strips.h"
+#include "trace.h"
+
+namespace {
+
+// side of the cube the lattice fills, in world units
+const float LATTICE_EXTENT = 2.0f;
+// phases spread over this many seconds of animation
+const float PHASE_RANGE = 60.0f;
+
+} // namespace
+
+void InstancedObjects::init() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &instanceBuffer);
+    glGenBuffers(1, &vertexBuffer);
+    glGenTextures(1, &vertexTexture);
+    glGenBuffers(1, &EBO);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+    glVertexAttribDivisor(0, 1);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    object = nullptr;
+    instances = 0;
+}
+
+void InstancedObjects::cleanup() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &instanceBuffer);
+    glDeleteBuffers(1, &vertexBuffer);
+    glDeleteTextures(1, &vertexTexture);
+    glDeleteBuffers(1, &EBO);
+    VAO = instanceBuffer = vertexBuffer = vertexTexture = EBO = 0;
+    object = nullptr;
+}
+
+void InstancedObjects::setObject(const NDimObjectData& source) {
+    if (&source == object && source.geometryGeneration == objectGeneration) {
+        return;
+    }
+    object = &source;
+    objectGeneration = source.geometryGeneration;
+    if (source.dimensions > MAX_INSTANCED_DIMENSIONS) {
+        return;
+    }
+    TraceScope trace("Instanced upload", "gl");
+    std::vector<unsigned int> strips;
+    if (source.renderEdges) {
+        buildLineStrips(source.vertexCount, source.edges, source.edgeCount, strips);
+    }
+    stripIndexCount = (int)strips.size();
+
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, (size_t)source.vertexCount * source.dimensions * sizeof(float), source.vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    glBindVertexArray(VAO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, strips.size() * sizeof(unsigned int), strips.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+}
+
+void InstancedObjects::setInstanceCount(int count) {
+    count = std::max(1, std::min(count, MAX_INSTANCES));
+    if (count == instances) {
+        return;
+    }
+    TraceScope trace("Instance layout", "gl");
+    instances = count;
+
+    // the smallest cubic lattice holding every copy, centered on the origin
+    int side = (int)std::ceil(std::cbrt((double)count));
+    while (side * side * side < count) {
+        side++;
+    }
+    spacing = LATTICE_EXTENT / side;
+    float origin = -0.5f * spacing * (side - 1);
+
+    // fixed seed: every run (and every offline shard) sees the same phases
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> phase(0.0f, PHASE_RANGE);
+    std::vector<float> data((size_t)count * 4);
+    for (int i = 0; i < count; i++) {
+        float* p = &data[(size_t)i * 4];
+        p[0] = origin + spacing * (i % side);
+        p[1] = origin + spacing * ((i / side) % side);
+        p[2] = origin + spacing * (i / (side * side));
+        p[3] = phase(random);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), data.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstancedObjects::draw(Shader& shader, float sceneTime) {
+    if (object == nullptr || object->dimensions > MAX_INSTANCED_DIMENSIONS || instances == 0) {
+        return;
+    }
+    int planeCount = object->numRotationPlanes;
+    if (planeCount > MAX_INSTANCED_PLANES) {
+        std::cout << "ERROR::INSTANCED::TOO_MANY_ROTATION_PLANES" << std::endl;
+        planeCount = MAX_INSTANCED_PLANES;
+    }
+    float planes[MAX_INSTANCED_PLANES * 3];
+    for (int p = 0; p < planeCount; p++) {
+        planes[p * 3] = (float)object->defaultRotationPlanes[p].axis1;
+        planes[p * 3 + 1] = (float)object->defaultRotationPlanes[p].axis2;
+        planes[p * 3 + 2] = object->defaultRotationPlanes[p].speed;
+    }
+    shader.setInt("vertexTable", 0);
+    shader.setInt("dimensions", object->dimensions);
+    shader.setFloatArray("rotationPlanes", planes, planeCount * 3);
+    shader.setInt("planeCount", planeCount);
+    shader.setFloat("sceneTime", sceneTime);
+    // at its own scale the object spans about two units; keep a gap between neighbours
+    shader.setFloat("scale", 0.4f * object->scale * spacing);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glBindVertexArray(VAO);
+    if (stripIndexCount > 0) {
+        glLineWidth(EDGE_THICKNESS);
+        glEnable(GL_PRIMITIVE_RESTART);
+        glPrimitiveRestartIndex(STRIP_RESTART_INDEX);
+        glDrawElementsInstanced(GL_LINE_STRIP, stripIndexCount, GL_UNSIGNED_INT, (void*)0, instances);
+        glDisable(GL_PRIMITIVE_RESTART);
+    }
+    glPointSize(VERTEX_SIZE);
+    glDrawArraysInstanced(GL_POINTS, 0, object->vertexCount, instances);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
@@ -0,0 +1,454 @@
+#include "offline_render.h"
+
+#include <glad/glad.h>
+#include "frame_state.h"
+#include "polytope_operators.h"
+#include "hypercube_objects.h"
+#include "render_path.h"
+#include "streamed_hypercube.h"
+#include "trace.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+struct CapturedFrame {
+    int index;
+    std::vector<unsigned char> pixels;   // RGB, bottom-up rows as returned by glReadPixels
+};
+
+// Encodes and writes frames on worker threads while the render thread keeps the GPU busy.
+// The queue is bounded so a slow disk throttles rendering instead of growing memory.
+class FrameWriterPool {
+public:
+    FrameWriterPool(const std::string& outputDir, int width, int height, int threadCount)
+        : outputDir(outputDir), width(width), height(height), maxPending(threadCount * 2) {
+        for (int i = 0; i < threadCount; i++) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~FrameWriterPool() {
+        finish();
+    }
+
+    // Drain the queue and stop the workers
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished = true;
+        }
+        queueChanged.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+
+    void push(CapturedFrame&& frame) {
+        std::unique_lock<std::mutex> lock(mutex);
+        queueChanged.wait(lock, [this]() { return (int)pending.size() < maxPending; });
+        pending.push_back(std::move(frame));
+        lock.unlock();
+        queueChanged.notify_all();
+    }
+
+    // Only meaningful after finish()
+    bool hadErrors() const { return failedWrites != 0; }
+
+private:
+    void workerLoop() {
+        traceSetThreadName("Frame writer");
+        for (;;) {
+            std::unique_lock<std::mutex> lock(mutex);
+            queueChanged.wait(lock, [this]() { return finished || !pending.empty(); });
+            if (pending.empty()) {
+                return;
+            }
+            CapturedFrame frame = std::move(pending.front());
+            pending.pop_front();
+            lock.unlock();
+            queueChanged.notify_all();
+
+            if (!writePPM(frame)) {
+                std::lock_guard<std::mutex> errorLock(mutex);
+                failedWrites++;
+            }
+        }
+    }
+
+    // Binary PPM: trivial to encode, and ffmpeg reads numbered sequences of it directly
+    bool writePPM(const CapturedFrame& frame) const {
+        TraceScope trace("Write frame", "offline");
+        char fileName[64];
+        snprintf(fileName, sizeof(fileName), "/frame_%06d.ppm", frame.index);
+        std::string path = outputDir + fileName;
+
+        FILE* file = fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            std::cout << "ERROR::OFFLINE::COULD_NOT_OPEN " << path << std::endl;
+            return false;
+        }
+        fprintf(file, "P6\n%d %d\n255\n", width, height);
+        // flip rows: GL returns the bottom row first
+        size_t rowBytes = (size_t)width * 3;
+        for (int y = height - 1; y >= 0; y--) {
+            fwrite(frame.pixels.data() + y * rowBytes, 1, rowBytes, file);
+        }
+        bool ok = ferror(file) == 0;
+        fclose(file);
+        return ok;
+    }
+
+    std::string outputDir;
+    int width;
+    int height;
+    int maxPending;
+    int failedWrites = 0;
+    bool finished = false;
+    std::deque<CapturedFrame> pending;
+    std::mutex mutex;
+    std::condition_variable queueChanged;
+    std::vector<std::thread> workers;
+};
+
+void makeDirectory(const std::string& path) {
+#ifdef _WIN32
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), 0755);
+#endif
+}
+
+// Command line for a child process rendering one shard of the same animation
+std::string shardCommand(const OfflineRenderSettings& settings, const char* executablePath, int shard) {
+    std::ostringstream cmd;
+    // enough digits that every shard parses back the exact float the parent uses
+    cmd << std::setprecision(std::numeric_limits<float>::max_digits10);
+    cmd << "\"" << executablePath << "\" --offline"
+        << " --frames " << settings.frameCount
+        << " --fps " << settings.fps
+        << " --width " << settings.width
+        << " --height " << settings.height
+        << " --time-ratio " << settings.timeRatio
+        << " --family " << settings.family
+        << " --dim " << settings.dimension
+        << (settings.dual ? " --dual" : "");
+    if (settings.polytopeOperator >= 0) {
+        cmd << " --operator " << polytopeOperatorName((PolytopeOperator)settings.polytopeOperator);
+    }
+    if (settings.slice) {
+        cmd << " --slice " << settings.sliceOffset;
+    }
+    if (settings.faces) {
+        cmd << " --faces " << settings.faceOpacity;
+    }
+    if (settings.glLines) {
+        cmd << " --gl-lines";
+    }
+    if (settings.glPoints) {
+        cmd << " --gl-points";
+    }
+    if (settings.gallery) {
+        cmd << " --gallery";
+    }
+    if (settings.instances > 0) {
+        cmd << " --instances " << settings.instances;
+    }
+    if (settings.cascade) {
+        cmd << " --cascade";
+    }
+    if (settings.scatterMatrix) {
+        cmd << " --scatter-matrix";
+    }
+    if (settings.renderPath != RENDER_PATH_POSITION) {
+        cmd << " --render-path " << renderPathName((RenderPath)settings.renderPath);
+    }
+    if (!settings.pointSetPath.empty()) {
+        cmd << " --points \"" << settings.pointSetPath << "\"";
+    }
+    if (!settings.zonotopePath.empty()) {
+        cmd << " --zonotope \"" << settings.zonotopePath << "\"";
+    }
+    cmd << " --threads " << settings.writerThreads
+        << " --out \"" << settings.outputDir << "\""
+        << " --shard " << shard
+        << " --shards " << settings.shardCount;
+#ifdef _WIN32
+    // cmd.exe strips the outermost pair of quotes from the whole line
+    return "\"" + cmd.str() + "\"";
+#else
+    return cmd.str();
+#endif
+}
+
+} // namespace
+
+bool parseOfflineArgs(int argc, char** argv, OfflineRenderSettings& settings) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--offline") {
+            settings.enabled = true;
+        }
+        else if (arg == "--frames" && hasValue) {
+            settings.frameCount = atoi(argv[++i]);
+        }
+        else if (arg == "--fps" && hasValue) {
+            settings.fps = (float)atof(argv[++i]);
+        }
+        else if (arg == "--width" && hasValue) {
+            settings.width = atoi(argv[++i]);
+        }
+        else if (arg == "--height" && hasValue) {
+            settings.height = atoi(argv[++i]);
+        }
+        else if (arg == "--time-ratio" && hasValue) {
+            settings.timeRatio = (float)atof(argv[++i]);
+        }
+        else if (arg == "--family" && hasValue) {
+            settings.family = atoi(argv[++i]);
+        }
+        else if (arg == "--dim" && hasValue) {
+            settings.dimension = atoi(argv[++i]);
+        }
+        else if (arg == "--dual") {
+            settings.dual = true;
+        }
+        else if (arg == "--operator" && hasValue) {
+            std::string name = argv[++i];
+            settings.polytopeOperator = -1;
+            for (int op = 0; op < OPERATOR_COUNT; op++) {
+                if (name == polytopeOperatorName((PolytopeOperator)op)) {
+                    settings.polytopeOperator = op;
+                }
+            }
+            if (settings.polytopeOperator < 0) {
+                std::cout << "Unknown polytope operator: " << name << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--slice" && hasValue) {
+            settings.slice = true;
+            settings.sliceOffset = (float)atof(argv[++i]);
+        }
+        else if (arg == "--faces" && hasValue) {
+            settings.faces = true;
+            settings.faceOpacity = (float)atof(argv[++i]);
+        }
+        else if (arg == "--gl-lines") {
+            settings.glLines = true;
+        }
+        else if (arg == "--gl-points") {
+            settings.glPoints = true;
+        }
+        else if (arg == "--gallery") {
+            settings.gallery = true;
+        }
+        else if (arg == "--instances" && hasValue) {
+            settings.instances = atoi(argv[++i]);
+        }
+        else if (arg == "--cascade") {
+            settings.cascade = true;
+        }
+        else if (arg == "--scatter-matrix") {
+            settings.scatterMatrix = true;
+        }
+        else if (arg == "--render-path" && hasValue) {
+            std::string name = argv[++i];
+            settings.renderPath = -1;
+            for (int path = 0; path < RENDER_PATH_COUNT; path++) {
+                if (name == renderPathName((RenderPath)path)) {
+                    settings.renderPath = path;
+                }
+            }
+            if (settings.renderPath < 0) {
+                std::cout << "Unknown render path: " << name << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--points" && hasValue) {
+            settings.pointSetPath = argv[++i];
+        }
+        else if (arg == "--zonotope" && hasValue) {
+            settings.zonotopePath = argv[++i];
+        }
+        else if (arg == "--out" && hasValue) {
+            settings.outputDir = argv[++i];
+        }
+        else if (arg == "--shard" && hasValue) {
+            settings.shardIndex = atoi(argv[++i]);
+        }
+        else if (arg == "--shards" && hasValue) {
+            settings.shardCount = atoi(argv[++i]);
+        }
+        else if (arg == "--jobs" && hasValue) {
+            settings.jobs = atoi(argv[++i]);
+        }
+        else if (arg == "--threads" && hasValue) {
+            settings.writerThreads = atoi(argv[++i]);
+        }
+        else {
+            std::cout << "Unknown or incomplete argument: " << arg << std::endl;
+            return false;
+        }
+    }
+
+    if (settings.jobs > 1) {
+        // this process becomes shard 0 of a freshly split render
+        settings.shardIndex = 0;
+        settings.shardCount = settings.jobs;
+    }
+
+    if (settings.width <= 0 || settings.height <= 0 || settings.fps <= 0.0f || settings.frameCount <= 0
+        || settings.shardCount <= 0 || settings.shardIndex < 0 || settings.shardIndex >= settings.shardCount) {
+        std::cout << "Invalid offline render settings" << std::endl;
+        return false;
+    }
+    // hypercubes above 8D are streamed; every other family is stored for 2D to 8D at most
+    int maxDimension = settings.family == 0 ? STREAM_MAX_DIMENSIONS : 8;
+    if (settings.family < 0 || settings.family >= SHAPE_TYPE_COUNT) {
+        std::cout << "Unknown shape family: " << settings.family << std::endl;
+        return false;
+    }
+    if (settings.dimension < 2 || settings.dimension > maxDimension) {
+        std::cout << "Unsupported dimension for family " << settings.family << ": " << settings.dimension << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int runOfflineRender(const OfflineRenderSettings& settings, const char* executablePath,
+                     const OfflineFrameRenderer& renderFrame) {
+    makeDirectory(settings.outputDir);
+
+    // Other shards run as independent processes: every frame only depends on its index,
+    // so they need no coordination beyond writing distinct file names.
+    std::vector<std::thread> children;
+    std::atomic<bool> shardFailed(false);
+    if (settings.jobs > 1) {
+        for (int shard = 1; shard < settings.shardCount; shard++) {
+            std::string cmd = shardCommand(settings, executablePath, shard);
+            children.emplace_back([cmd, &shardFailed]() {
+                if (std::system(cmd.c_str()) != 0) {
+                    std::cout << "ERROR::OFFLINE::SHARD_FAILED " << cmd << std::endl;
+                    shardFailed = true;
+                }
+            });
+        }
+    }
+
+    int firstFrame = (int)((long long)settings.frameCount * settings.shardIndex / settings.shardCount);
+    int endFrame = (int)((long long)settings.frameCount * (settings.shardIndex + 1) / settings.shardCount);
+
+    // offscreen target at the requested resolution, independent of the (hidden) window
+    unsigned int fbo, colorRbo, depthRbo;
+    glGenFramebuffers(1, &fbo);
+    glGenRenderbuffers(1, &colorRbo);
+    glGenRenderbuffers(1, &depthRbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, colorRbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGB8, settings.width, settings.height);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthRbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, settings.width, settings.height);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthRbo);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cout << "ERROR::OFFLINE::FRAMEBUFFER_INCOMPLETE" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        for (std::thread& child : children) {
+            child.join();
+        }
+        return -1;
+    }
+    glViewport(0, 0, settings.width, settings.height);
+
+    // Two pixel-pack buffers: frame i is read back asynchronously while frame i-1 is mapped,
+    // so the CPU never stalls waiting for the frame it just submitted.
+    size_t frameBytes = (size_t)settings.width * settings.height * 3;
+    unsigned int pbos[2];
+    glGenBuffers(2, pbos);
+    for (int i = 0; i < 2; i++) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[i]);
+        glBufferData(GL_PIXEL_PACK_BUFFER, frameBytes, nullptr, GL_STREAM_READ);
+    }
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    int writerThreads = settings.writerThreads > 0 ? settings.writerThreads : (int)std::thread::hardware_concurrency();
+    if (writerThreads <= 0) {
+        writerThreads = 2;
+    }
+
+    bool writeErrors = false;
+    {
+        FrameWriterPool writer(settings.outputDir, settings.width, settings.height, writerThreads);
+
+        bool mapFailed = false;
+        auto collect = [&](int frameIndex) {
+            TraceScope trace("Readback", "offline");
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[frameIndex % 2]);
+            const unsigned char* mapped = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frameBytes, GL_MAP_READ_BIT);
+            if (mapped == nullptr) {
+                std::cout << "ERROR::OFFLINE::MAP_FAILED frame " << frameIndex << std::endl;
+                mapFailed = true;
+                return;
+            }
+            CapturedFrame frame;
+            frame.index = frameIndex;
+            frame.pixels.assign(mapped, mapped + frameBytes);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            writer.push(std::move(frame));
+        };
+
+        for (int frameIndex = firstFrame; frameIndex < endFrame; frameIndex++) {
+            TraceScope trace("Offline frame", "offline");
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+            renderFrame(frameSceneTime(frameIndex, settings.fps, settings.timeRatio), settings.width, settings.height);
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[frameIndex % 2]);
+            glReadPixels(0, 0, settings.width, settings.height, GL_RGB, GL_UNSIGNED_BYTE, (void*)0);
+
+            if (frameIndex > firstFrame) {
+                collect(frameIndex - 1);
+            }
+        }
+        if (endFrame > firstFrame) {
+            collect(endFrame - 1);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        writer.finish();
+        writeErrors = writer.hadErrors() || mapFailed;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteBuffers(2, pbos);
+    glDeleteRenderbuffers(1, &colorRbo);
+    glDeleteRenderbuffers(1, &depthRbo);
+    glDeleteFramebuffers(1, &fbo);
+
+    for (std::thread& child : children) {
+        child.join();
+    }
+
+    std::cout << "Offline shard " << settings.shardIndex << "/" << settings.shardCount
+              << " wrote frames " << firstFrame << "-" << endFrame - 1 << " to " << settings.outputDir << std::endl;
+    return writeErrors || shardFailed ? -1 : 0;
+}
@@ -0,0 +1,38 @@
+#include "parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+int parallelThreadCount(int threadCount) {
+    return threadCount > 0 ? threadCount : std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+void parallelFor(int count, int threadCount, const std::function<void(int, int)>& body) {
+    const int BLOCK = 16;
+    threadCount = std::min(parallelThreadCount(threadCount), (count + BLOCK - 1) / BLOCK);
+    if (threadCount <= 1) {
+        for (int i = 0; i < count; i++) {
+            body(i, 0);
+        }
+        return;
+    }
+    std::atomic<int> next(0);
+    auto run = [&](int worker) {
+        for (int begin = next.fetch_add(BLOCK); begin < count; begin = next.fetch_add(BLOCK)) {
+            int end = std::min(begin + BLOCK, count);
+            for (int i = begin; i < end; i++) {
+                body(i, worker);
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < threadCount; t++) {
+        threads.emplace_back(run, t);
+    }
+    run(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
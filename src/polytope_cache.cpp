@@ -0,0 +1,263 @@
+#include "polytope_cache.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include "face_lattice.h"
+#include "trace.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <direct.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(PolytopeCacheHeader) == 80, "cache header layout changed; bump POLYTOPE_CACHE_VERSION");
+
+namespace {
+
+size_t alignSection(size_t offset) {
+    return (offset + 15) & ~(size_t)15;
+}
+
+uint64_t headerChecksum(const PolytopeCacheHeader& header) {
+    return fnv1a64(&header, offsetof(PolytopeCacheHeader, checksum));
+}
+
+// every section is read in place as float32 / uint32
+bool sectionAligned(uint64_t offset) {
+    return offset % sizeof(uint32_t) == 0;
+}
+
+// the section data isn't checksummed, so an index past the vertex table is caught here
+bool indicesInRange(const unsigned int* indices, size_t count, uint32_t limit) {
+    for (size_t i = 0; i < count; i++) {
+        if (indices[i] >= limit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void makeDirectory(const std::string& path) {
+#ifdef _WIN32
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), 0755);
+#endif
+}
+
+} // namespace
+
+uint64_t fnv1a64(const void* data, size_t bytes, uint64_t hash) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < bytes; i++) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t hashPolytopeParams(const char* family, int dims, const std::string& params) {
+    uint64_t hash = fnv1a64(family, strlen(family));
+    hash = fnv1a64(&dims, sizeof(dims), hash);
+    hash = fnv1a64(params.data(), params.size(), hash);
+    return fnv1a64(&POLYTOPE_CACHE_VERSION, sizeof(POLYTOPE_CACHE_VERSION), hash);
+}
+
+std::string polytopeCachePath(const std::string& dir, const char* family, int dims, uint64_t paramsHash) {
+    char name[128];
+    snprintf(name, sizeof(name), "/%s_%dD_%016llx.ndpc", family, dims, (unsigned long long)paramsHash);
+    return dir + name;
+}
+
+void serializePolytope(const PolytopeMesh& mesh, uint64_t paramsHash, std::vector<unsigned char>& out) {
+    PolytopeCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, POLYTOPE_CACHE_MAGIC, sizeof(header.magic));
+    header.version = POLYTOPE_CACHE_VERSION;
+    header.headerBytes = sizeof(PolytopeCacheHeader);
+    header.dimensions = mesh.dimensions;
+    header.vertexCount = mesh.vertexCount();
+    header.edgeCount = mesh.edgeCount();
+    header.latticeWords = (uint32_t)mesh.lattice.size();
+    header.paramsHash = paramsHash;
+    header.vertexOffset = alignSection(sizeof(PolytopeCacheHeader));
+    header.edgeOffset = alignSection(header.vertexOffset + mesh.vertices.size() * sizeof(float));
+    header.latticeOffset = alignSection(header.edgeOffset + mesh.edges.size() * sizeof(unsigned int));
+    header.fileBytes = alignSection(header.latticeOffset + mesh.lattice.size() * sizeof(unsigned int));
+
+    out.assign(header.fileBytes, 0);
+    if (!mesh.vertices.empty()) {
+        memcpy(out.data() + header.vertexOffset, mesh.vertices.data(), mesh.vertices.size() * sizeof(float));
+    }
+    if (!mesh.edges.empty()) {
+        memcpy(out.data() + header.edgeOffset, mesh.edges.data(), mesh.edges.size() * sizeof(unsigned int));
+    }
+    if (!mesh.lattice.empty()) {
+        memcpy(out.data() + header.latticeOffset, mesh.lattice.data(), mesh.lattice.size() * sizeof(unsigned int));
+    }
+    header.checksum = headerChecksum(header);
+    memcpy(out.data(), &header, sizeof(header));
+}
+
+bool writePolytopeCache(const std::string& path, const PolytopeMesh& mesh, uint64_t paramsHash) {
+    std::vector<unsigned char> image;
+    serializePolytope(mesh, paramsHash, image);
+
+    std::string temporary = path + ".tmp" + std::to_string(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    FILE* file = fopen(temporary.c_str(), "wb");
+    if (file == nullptr) {
+        std::cout << "ERROR::POLYTOPE_CACHE::COULD_NOT_WRITE " << temporary << std::endl;
+        return false;
+    }
+    bool ok = fwrite(image.data(), 1, image.size(), file) == image.size();
+    ok = fclose(file) == 0 && ok;
+
+    // another process may have finished the same file first; either copy is valid
+    if (ok && std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(path.c_str());
+        ok = std::rename(temporary.c_str(), path.c_str()) == 0;
+    }
+    if (!ok) {
+        std::remove(temporary.c_str());
+        std::cout << "ERROR::POLYTOPE_CACHE::COULD_NOT_WRITE " << path << std::endl;
+    }
+    return ok;
+}
+
+PolytopeCacheFile::~PolytopeCacheFile() {
+    close();
+}
+
+void PolytopeCacheFile::close() {
+#ifdef _WIN32
+    if (mapping != nullptr) {
+        UnmapViewOfFile(mapping);
+    }
+    if (mappingHandle != nullptr) {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle != nullptr) {
+        CloseHandle(fileHandle);
+    }
+    fileHandle = nullptr;
+    mappingHandle = nullptr;
+#else
+    if (mapping != nullptr) {
+        munmap(mapping, size);
+    }
+#endif
+    mapping = nullptr;
+    base = nullptr;
+    size = 0;
+    owned.clear();
+}
+
+bool PolytopeCacheFile::open(const std::string& path, uint64_t expectedParamsHash) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    fileHandle = file;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(PolytopeCacheHeader)) {
+        close();
+        return false;
+    }
+    mappingHandle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mappingHandle == nullptr) {
+        close();
+        return false;
+    }
+    mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    size = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(PolytopeCacheHeader)) {
+        ::close(fd);
+        return false;
+    }
+    size = (size_t)info.st_size;
+    void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);                              // the mapping keeps the file alive
+    mapping = view == MAP_FAILED ? nullptr : view;
+#endif
+    if (mapping == nullptr) {
+        close();
+        return false;
+    }
+    base = static_cast<const unsigned char*>(mapping);
+
+    const PolytopeCacheHeader& h = header();
+    bool valid = memcmp(h.magic, POLYTOPE_CACHE_MAGIC, sizeof(h.magic)) == 0
+        && h.version == POLYTOPE_CACHE_VERSION
+        && h.headerBytes == sizeof(PolytopeCacheHeader)
+        && h.paramsHash == expectedParamsHash
+        && h.fileBytes == size
+        && h.checksum == headerChecksum(h)
+        && sectionAligned(h.vertexOffset) && sectionAligned(h.edgeOffset) && sectionAligned(h.latticeOffset)
+        && h.vertexOffset >= sizeof(PolytopeCacheHeader)
+        && h.vertexOffset + (uint64_t)h.vertexCount * h.dimensions * sizeof(float) <= h.edgeOffset
+        && h.edgeOffset + (uint64_t)h.edgeCount * 2 * sizeof(unsigned int) <= h.latticeOffset
+        && h.latticeOffset + (uint64_t)h.latticeWords * sizeof(unsigned int) <= h.fileBytes
+        && indicesInRange(reinterpret_cast<const unsigned int*>(base + h.edgeOffset), (size_t)h.edgeCount * 2, h.vertexCount);
+    if (!valid) {
+        std::cout << "ERROR::POLYTOPE_CACHE::INVALID_FILE " << path << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void PolytopeCacheFile::adopt(PolytopeMesh&& mesh) {
+    close();
+    serializePolytope(mesh, 0, owned);
+    base = owned.data();
+    size = owned.size();
+}
+
+std::unique_ptr<PolytopeCacheFile> loadOrGeneratePolytope(const char* family, int dims, const std::string& params,
+                                                          const std::function<void(PolytopeMesh&)>& generate) {
+    TraceScope trace("Load polytope", "geometry");
+    uint64_t paramsHash = hashPolytopeParams(family, dims, params);
+    std::string path = polytopeCachePath(POLYTOPE_CACHE_DIR, family, dims, paramsHash);
+
+    std::unique_ptr<PolytopeCacheFile> file(new PolytopeCacheFile());
+    if (file->open(path, paramsHash)) {
+        return file;
+    }
+
+    PolytopeMesh mesh;
+    {
+        TraceScope generateTrace("Generate polytope", "geometry");
+        generate(mesh);
+    }
+    if (mesh.lattice.empty() && mesh.facetCount() > 0) {
+        FaceLattice lattice;
+        if (buildFaceLattice(mesh, lattice)) {
+            serializeFaceLattice(lattice, mesh.lattice);
+        }
+    }
+    makeDirectory(POLYTOPE_CACHE_DIR);
+    if (writePolytopeCache(path, mesh, paramsHash) && file->open(path, paramsHash)) {
+        return file;
+    }
+    // read-only working directory: keep the generated copy in memory
+    file->adopt(std::move(mesh));
+    return file;
+}
@@ -0,0 +1,134 @@
+#include "polytope_generators.h"
+
+#include <algorithm>
+#include <cmath>
+
+static void beginFacets(PolytopeMesh& mesh) {
+    mesh.facetOffsets.assign(1, 0);
+    mesh.facetVertices.clear();
+}
+
+static void endFacet(PolytopeMesh& mesh) {
+    mesh.facetOffsets.push_back((unsigned int)mesh.facetVertices.size());
+}
+
+void generateHypercube(int dims, PolytopeMesh& mesh) {
+    unsigned int count = 1u << dims;
+    mesh.dimensions = dims;
+    mesh.vertices.resize((size_t)count * dims);
+    mesh.edges.clear();
+    mesh.edges.reserve((size_t)dims * count);
+    mesh.lattice.clear();
+
+    for (unsigned int v = 0; v < count; v++) {
+        for (int j = 0; j < dims; j++) {
+            mesh.vertices[(size_t)v * dims + j] = (v >> j) & 1 ? 1.0f : -1.0f;
+        }
+        // one edge per neighbour with a higher index
+        for (int j = 0; j < dims; j++) {
+            unsigned int neighbour = v ^ (1u << j);
+            if (neighbour > v) {
+                mesh.edges.push_back(v);
+                mesh.edges.push_back(neighbour);
+            }
+        }
+    }
+
+    beginFacets(mesh);
+    for (int j = 0; j < dims; j++) {
+        for (unsigned int side = 0; side < 2; side++) {
+            for (unsigned int v = 0; v < count; v++) {
+                if (((v >> j) & 1) == side) {
+                    mesh.facetVertices.push_back(v);
+                }
+            }
+            endFacet(mesh);
+        }
+    }
+}
+
+void generateSimplex(int dims, PolytopeMesh& mesh) {
+    int count = dims + 1;
+    mesh.dimensions = dims;
+    mesh.vertices.assign((size_t)count * dims, 0.0f);
+    mesh.edges.clear();
+    mesh.lattice.clear();
+
+    // Helmert basis u_k = (1, ..., 1, -k, 0, ...) / sqrt(k (k + 1)), k = 1..N, with k leading ones.
+    // Scaling by sqrt(2) turns the unit-basis edge length sqrt(2) into 2.
+    for (int k = 1; k <= dims; k++) {
+        double norm = std::sqrt(2.0 / ((double)k * (k + 1)));
+        for (int i = 0; i < count; i++) {
+            double component = i < k ? 1.0 : i == k ? -(double)k : 0.0;
+            mesh.vertices[(size_t)i * dims + (k - 1)] = (float)(component * norm);
+        }
+    }
+
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            mesh.edges.push_back(a);
+            mesh.edges.push_back(b);
+        }
+    }
+
+    beginFacets(mesh);
+    for (int i = 0; i < count; i++) {
+        for (int v = 0; v < count; v++) {
+            if (v != i) {
+                mesh.facetVertices.push_back(v);
+            }
+        }
+        endFacet(mesh);
+    }
+}
+
+void generateCrossPolytope(int dims, PolytopeMesh& mesh) {
+    int count = 2 * dims;
+    mesh.dimensions = dims;
+    mesh.vertices.assign((size_t)count * dims, 0.0f);
+    mesh.edges.clear();
+    mesh.lattice.clear();
+
+    for (int i = 0; i < dims; i++) {
+        mesh.vertices[(size_t)(2 * i) * dims + i] = 1.0f;
+        mesh.vertices[(size_t)(2 * i + 1) * dims + i] = -1.0f;
+    }
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            if (a / 2 != b / 2) {
+                mesh.edges.push_back(a);
+                mesh.edges.push_back(b);
+            }
+        }
+    }
+
+    beginFacets(mesh);
+    for (unsigned int orthant = 0; orthant < (1u << dims); orthant++) {
+        for (int i = 0; i < dims; i++) {
+            mesh.facetVertices.push_back(2 * i + ((orthant >> i) & 1));
+        }
+        endFacet(mesh);
+    }
+}
+
+void generatePolygon(int sides, PolytopeMesh& mesh) {
+    const double PI = 3.14159265358979323846;
+    mesh.dimensions = 2;
+    mesh.vertices.resize((size_t)sides * 2);
+    mesh.edges.clear();
+    mesh.lattice.clear();
+    beginFacets(mesh);
+    for (int i = 0; i < sides; i++) {
+        double angle = 2.0 * PI * i / sides;
+        mesh.vertices[(size_t)i * 2] = (float)std::cos(angle);
+        mesh.vertices[(size_t)i * 2 + 1] = (float)std::sin(angle);
+
+        unsigned int a = i;
+        unsigned int b = (i + 1) % sides;
+        mesh.edges.push_back(std::min(a, b));
+        mesh.edges.push_back(std::max(a, b));
+        mesh.facetVertices.push_back(std::min(a, b));
+        mesh.facetVertices.push_back(std::max(a, b));
+        endFacet(mesh);
+    }
+}
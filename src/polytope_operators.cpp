@@ -0,0 +1,683 @@
+#include "polytope_operators.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include "face_lattice.h"
+#include "parallel_for.h"
+#include "trace.h"
+
+static const int POLYTOPE_OPERATOR_MAX_DIMS = 8;
+
+void productPolytope(const PolytopeMesh& a, const PolytopeMesh& b, PolytopeMesh& out) {
+    const int da = a.dimensions;
+    const int db = b.dimensions;
+    const int na = a.vertexCount();
+    const int nb = b.vertexCount();
+    const int dims = da + db;
+
+    out.dimensions = dims;
+    out.vertices.resize((size_t)na * nb * dims);
+    for (int i = 0; i < na; i++) {
+        for (int j = 0; j < nb; j++) {
+            float* v = &out.vertices[((size_t)i * nb + j) * dims];
+            for (int c = 0; c < da; c++) {
+                v[c] = a.vertices[(size_t)i * da + c];
+            }
+            for (int c = 0; c < db; c++) {
+                v[da + c] = b.vertices[(size_t)j * db + c];
+            }
+        }
+    }
+
+    out.edges.clear();
+    out.edges.reserve(2 * ((size_t)a.edgeCount() * nb + (size_t)na * b.edgeCount()));
+    for (int e = 0; e < a.edgeCount(); e++) {
+        unsigned int i1 = a.edges[2 * e];
+        unsigned int i2 = a.edges[2 * e + 1];
+        for (int j = 0; j < nb; j++) {
+            out.edges.push_back(i1 * nb + j);
+            out.edges.push_back(i2 * nb + j);
+        }
+    }
+    for (int i = 0; i < na; i++) {
+        for (int e = 0; e < b.edgeCount(); e++) {
+            out.edges.push_back(i * nb + b.edges[2 * e]);
+            out.edges.push_back(i * nb + b.edges[2 * e + 1]);
+        }
+    }
+
+    out.facetOffsets.clear();
+    out.facetVertices.clear();
+    out.lattice.clear();
+    if (a.facetCount() == 0 || b.facetCount() == 0) {
+        return;
+    }
+    out.facetVertices.reserve((size_t)nb * a.facetVertices.size() + (size_t)na * b.facetVertices.size());
+    out.facetOffsets.reserve((size_t)a.facetCount() + b.facetCount() + 1);
+    out.facetOffsets.push_back(0);
+    // facet vertex lists stay sorted: i ascends in the outer loop, j in the inner one
+    for (int f = 0; f < a.facetCount(); f++) {
+        for (unsigned int k = a.facetOffsets[f]; k < a.facetOffsets[f + 1]; k++) {
+            unsigned int i = a.facetVertices[k];
+            for (int j = 0; j < nb; j++) {
+                out.facetVertices.push_back(i * nb + j);
+            }
+        }
+        out.facetOffsets.push_back((unsigned int)out.facetVertices.size());
+    }
+    for (int f = 0; f < b.facetCount(); f++) {
+        for (int i = 0; i < na; i++) {
+            for (unsigned int k = b.facetOffsets[f]; k < b.facetOffsets[f + 1]; k++) {
+                out.facetVertices.push_back(i * nb + b.facetVertices[k]);
+            }
+        }
+        out.facetOffsets.push_back((unsigned int)out.facetVertices.size());
+    }
+}
+
+// Unit normal of the hyperplane through the rows' points, all taken relative to a point on
+// it. Row reduction with partial pivoting; the one column left without a pivot is free.
+static bool hyperplaneNormal(std::vector<double>& rows, int rowCount, int dims, double tolerance, double* normal) {
+    bool pivot[POLYTOPE_OPERATOR_MAX_DIMS] = {};
+    int pivotColumn[POLYTOPE_OPERATOR_MAX_DIMS];
+    int rank = 0;
+    for (int col = 0; col < dims && rank < dims - 1 && rank < rowCount; col++) {
+        int best = rank;
+        for (int r = rank + 1; r < rowCount; r++) {
+            if (std::fabs(rows[(size_t)r * dims + col]) > std::fabs(rows[(size_t)best * dims + col])) {
+                best = r;
+            }
+        }
+        if (std::fabs(rows[(size_t)best * dims + col]) <= tolerance) {
+            continue;
+        }
+        for (int c = 0; c < dims; c++) {
+            std::swap(rows[(size_t)rank * dims + c], rows[(size_t)best * dims + c]);
+        }
+        double inverse = 1.0 / rows[(size_t)rank * dims + col];
+        for (int c = 0; c < dims; c++) {
+            rows[(size_t)rank * dims + c] *= inverse;
+        }
+        for (int r = 0; r < rowCount; r++) {
+            double factor = rows[(size_t)r * dims + col];
+            if (r != rank && factor != 0.0) {
+                for (int c = 0; c < dims; c++) {
+                    rows[(size_t)r * dims + c] -= factor * rows[(size_t)rank * dims + c];
+                }
+            }
+        }
+        pivot[col] = true;
+        pivotColumn[rank++] = col;
+    }
+    if (rank != dims - 1) {
+        return false;
+    }
+    int freeColumn = 0;
+    while (pivot[freeColumn]) {
+        freeColumn++;
+    }
+
+    double length = 1.0;
+    for (int c = 0; c < dims; c++) {
+        normal[c] = 0.0;
+    }
+    normal[freeColumn] = 1.0;
+    for (int r = 0; r < rank; r++) {
+        normal[pivotColumn[r]] = -rows[(size_t)r * dims + freeColumn];
+        length += normal[pivotColumn[r]] * normal[pivotColumn[r]];
+    }
+    length = std::sqrt(length);
+    for (int c = 0; c < dims; c++) {
+        normal[c] /= length;
+    }
+    return true;
+}
+
+bool dualPolytope(const float* vertices, int dims, const FaceLattice& lattice, PolytopeMesh& out,
+                  DualPlacement placement, int threadCount) {
+    TraceScope trace("Dual polytope", "geometry");
+    if (lattice.empty() || lattice.dimensions != dims || dims < 2 || dims > POLYTOPE_OPERATOR_MAX_DIMS) {
+        std::cout << "ERROR::DUAL::NO_LATTICE" << std::endl;
+        return false;
+    }
+    const int vertexCount = lattice.faceCount(0);
+    const int facetRank = dims - 1;
+    const int facetCount = lattice.faceCount(facetRank);
+    const int firstFacet = lattice.firstFace(facetRank);
+
+    double center[POLYTOPE_OPERATOR_MAX_DIMS] = {};
+    double extent = 0.0;
+    for (int v = 0; v < vertexCount; v++) {
+        for (int c = 0; c < dims; c++) {
+            center[c] += vertices[(size_t)v * dims + c];
+            extent = std::max(extent, (double)std::fabs(vertices[(size_t)v * dims + c]));
+        }
+    }
+    for (int c = 0; c < dims; c++) {
+        center[c] /= vertexCount;
+    }
+    const double tolerance = 1e-6 * std::max(extent, 1e-30);
+
+    // one vertex per facet
+    out.dimensions = dims;
+    out.vertices.resize((size_t)facetCount * dims);
+    threadCount = parallelThreadCount(threadCount);
+    std::vector<std::vector<double>> scratch(threadCount);
+    std::atomic<int> failedFacet(-1);
+    parallelFor(facetCount, threadCount, [&](int f, int worker) {
+        int face = firstFacet + f;
+        int count = lattice.faceVertexCount(face);
+        const unsigned int* facetVertices = lattice.faceVertices(face);
+        double centroid[POLYTOPE_OPERATOR_MAX_DIMS] = {};
+        for (int i = 0; i < count; i++) {
+            for (int c = 0; c < dims; c++) {
+                centroid[c] += vertices[(size_t)facetVertices[i] * dims + c];
+            }
+        }
+        for (int c = 0; c < dims; c++) {
+            centroid[c] /= count;
+        }
+
+        float* dualVertex = &out.vertices[(size_t)f * dims];
+        if (placement == DUAL_CENTROID) {
+            for (int c = 0; c < dims; c++) {
+                dualVertex[c] = (float)centroid[c];
+            }
+            return;
+        }
+
+        std::vector<double>& rows = scratch[worker];
+        rows.resize((size_t)count * dims);
+        for (int i = 0; i < count; i++) {
+            for (int c = 0; c < dims; c++) {
+                rows[(size_t)i * dims + c] = vertices[(size_t)facetVertices[i] * dims + c] - centroid[c];
+            }
+        }
+        double normal[POLYTOPE_OPERATOR_MAX_DIMS];
+        double height = 0.0;
+        if (hyperplaneNormal(rows, count, dims, tolerance, normal)) {
+            for (int c = 0; c < dims; c++) {
+                height += normal[c] * (centroid[c] - center[c]);
+            }
+        }
+        if (std::fabs(height) <= tolerance) {
+            failedFacet = f;
+            return;
+        }
+        for (int c = 0; c < dims; c++) {
+            dualVertex[c] = (float)(center[c] + normal[c] / height);
+        }
+    });
+    if (failedFacet >= 0) {
+        std::cout << "ERROR::DUAL::DEGENERATE_FACET " << failedFacet << std::endl;
+        return false;
+    }
+
+    // an edge through every ridge, between the two facets that share it
+    const int ridgeRank = dims - 2;
+    out.edges.clear();
+    out.edges.reserve((size_t)lattice.faceCount(ridgeRank) * 2);
+    for (int r = lattice.firstFace(ridgeRank); r < lattice.firstFace(ridgeRank) + lattice.faceCount(ridgeRank); r++) {
+        if (lattice.cofaceCount(r) == 2) {
+            out.edges.push_back(lattice.coface(r)[0] - firstFacet);
+            out.edges.push_back(lattice.coface(r)[1] - firstFacet);
+        }
+    }
+
+    // a facet around every vertex: invert the facet -> vertex incidence (counting sort,
+    // filled in facet order so each list comes out sorted)
+    out.facetOffsets.assign((size_t)vertexCount + 1, 0);
+    for (int f = firstFacet; f < firstFacet + facetCount; f++) {
+        for (int i = 0; i < lattice.faceVertexCount(f); i++) {
+            out.facetOffsets[lattice.faceVertices(f)[i] + 1]++;
+        }
+    }
+    for (int v = 0; v < vertexCount; v++) {
+        out.facetOffsets[v + 1] += out.facetOffsets[v];
+    }
+    out.facetVertices.resize(out.facetOffsets.back());
+    std::vector<unsigned int> fill(out.facetOffsets.begin(), out.facetOffsets.end() - 1);
+    for (int f = 0; f < facetCount; f++) {
+        for (int i = 0; i < lattice.faceVertexCount(firstFacet + f); i++) {
+            out.facetVertices[fill[lattice.faceVertices(firstFacet + f)[i]]++] = (unsigned int)f;
+        }
+    }
+    out.lattice.clear();
+    return true;
+}
+
+bool samePolytope(const PolytopeMesh& a, const PolytopeMesh& b, float tolerance) {
+    const int dims = a.dimensions;
+    if (dims != b.dimensions || a.vertexCount() != b.vertexCount() || a.edgeCount() != b.edgeCount()) {
+        return false;
+    }
+    // a's vertex i is b's vertex match[i]
+    std::vector<int> match(a.vertexCount(), -1);
+    std::vector<bool> taken(b.vertexCount(), false);
+    for (int i = 0; i < a.vertexCount(); i++) {
+        for (int j = 0; j < b.vertexCount() && match[i] < 0; j++) {
+            bool same = !taken[j];
+            for (int c = 0; same && c < dims; c++) {
+                same = std::fabs(a.vertices[(size_t)i * dims + c] - b.vertices[(size_t)j * dims + c]) <= tolerance;
+            }
+            if (same) {
+                match[i] = j;
+                taken[j] = true;
+            }
+        }
+        if (match[i] < 0) {
+            return false;
+        }
+    }
+
+    std::vector<unsigned long long> edgesA;
+    std::vector<unsigned long long> edgesB;
+    for (int e = 0; e < a.edgeCount(); e++) {
+        unsigned long long u = (unsigned int)match[a.edges[2 * e]];
+        unsigned long long v = (unsigned int)match[a.edges[2 * e + 1]];
+        edgesA.push_back(u < v ? (u << 32) | v : (v << 32) | u);
+        u = b.edges[2 * e];
+        v = b.edges[2 * e + 1];
+        edgesB.push_back(u < v ? (u << 32) | v : (v << 32) | u);
+    }
+    std::sort(edgesA.begin(), edgesA.end());
+    std::sort(edgesB.begin(), edgesB.end());
+    return edgesA == edgesB;
+}
+
+const char* polytopeOperatorName(PolytopeOperator op) {
+    static const char* const names[] = { "truncate", "rectify", "bitruncate", "cantellate" };
+    return op >= 0 && op < OPERATOR_COUNT ? names[op] : "unknown";
+}
+
+unsigned int polytopeOperatorRanks(PolytopeOperator op) {
+    static const unsigned int ranks[] = { 0x3, 0x2, 0x6, 0x5 };
+    return op >= 0 && op < OPERATOR_COUNT ? ranks[op] : 0;
+}
+
+namespace {
+
+// Faces of rank toRank containing (above) or contained in (below) a face of rank fromRank, sorted
+void facesAbove(const FaceLattice& lattice, unsigned int face, int fromRank, int toRank,
+                std::vector<unsigned int>& out, std::vector<unsigned int>& next) {
+    out.assign(1, face);
+    for (int rank = fromRank; rank < toRank; rank++) {
+        next.clear();
+        for (unsigned int f : out) {
+            next.insert(next.end(), lattice.coface(f), lattice.coface(f) + lattice.cofaceCount(f));
+        }
+        std::sort(next.begin(), next.end());
+        next.erase(std::unique(next.begin(), next.end()), next.end());
+        out.swap(next);
+    }
+}
+
+void facesBelow(const FaceLattice& lattice, unsigned int face, int fromRank, int toRank,
+                std::vector<unsigned int>& out, std::vector<unsigned int>& next) {
+    out.assign(1, face);
+    for (int rank = fromRank; rank > toRank; rank--) {
+        next.clear();
+        for (unsigned int f : out) {
+            next.insert(next.end(), lattice.boundary(f), lattice.boundary(f) + lattice.boundaryCount(f));
+        }
+        std::sort(next.begin(), next.end());
+        next.erase(std::unique(next.begin(), next.end()), next.end());
+        out.swap(next);
+    }
+}
+
+bool faceContains(const FaceLattice& lattice, unsigned int outer, unsigned int inner) {
+    const unsigned int* a = lattice.faceVertices(outer);
+    const unsigned int* b = lattice.faceVertices(inner);
+    return std::includes(a, a + lattice.faceVertexCount(outer), b, b + lattice.faceVertexCount(inner));
+}
+
+void faceCentroid(const FaceLattice& lattice, const float* vertices, int dims, unsigned int face, double* centroid) {
+    int count = lattice.faceVertexCount(face);
+    const unsigned int* faceVertices = lattice.faceVertices(face);
+    for (int c = 0; c < dims; c++) {
+        centroid[c] = 0.0;
+    }
+    for (int i = 0; i < count; i++) {
+        for (int c = 0; c < dims; c++) {
+            centroid[c] += vertices[(size_t)faceVertices[i] * dims + c];
+        }
+    }
+    for (int c = 0; c < dims; c++) {
+        centroid[c] /= count;
+    }
+}
+
+// Per-thread scratch for walking the lattice
+struct ChainScratch {
+    std::vector<unsigned int> levels[POLYTOPE_OPERATOR_MAX_DIMS];
+    std::vector<unsigned int> next;
+    std::vector<unsigned int> candidates;
+    std::vector<unsigned int> lows;
+    std::vector<unsigned int> ups;
+    std::vector<unsigned int> chain;
+};
+
+// Every chain extending chain[0..level) with one face of each remaining ringed rank
+void extendChain(const FaceLattice& lattice, const int* ranks, int rankCount, int level,
+                 ChainScratch& scratch, std::vector<unsigned int>& out) {
+    if (level == rankCount) {
+        out.insert(out.end(), scratch.chain.begin(), scratch.chain.end());
+        return;
+    }
+    std::vector<unsigned int>& candidates = scratch.levels[level];
+    facesAbove(lattice, scratch.chain[level - 1], ranks[level - 1], ranks[level], candidates, scratch.next);
+    for (unsigned int face : candidates) {
+        scratch.chain[level] = face;
+        extendChain(lattice, ranks, rankCount, level + 1, scratch, out);
+    }
+}
+
+} // namespace
+
+bool ringedPolytope(const float* vertices, int dims, const FaceLattice& lattice, unsigned int rankMask,
+                    PolytopeMesh& out, int threadCount) {
+    TraceScope trace("Ringed polytope", "geometry");
+    if (lattice.empty() || lattice.dimensions != dims || dims < 2 || dims > POLYTOPE_OPERATOR_MAX_DIMS) {
+        std::cout << "ERROR::RINGED_POLYTOPE::NO_LATTICE" << std::endl;
+        return false;
+    }
+    int ranks[POLYTOPE_OPERATOR_MAX_DIMS];
+    int rankCount = 0;
+    int rankSlot[POLYTOPE_OPERATOR_MAX_DIMS];     // rank -> index in a chain, -1 if not ringed
+    for (int rank = 0; rank < dims; rank++) {
+        rankSlot[rank] = -1;
+        if (rankMask & (1u << rank)) {
+            rankSlot[rank] = rankCount;
+            ranks[rankCount++] = rank;
+        }
+    }
+    if (rankCount == 0 || (rankMask >> dims) != 0) {
+        std::cout << "ERROR::RINGED_POLYTOPE::BAD_RANKS " << rankMask << " for " << dims << "D" << std::endl;
+        return false;
+    }
+    threadCount = parallelThreadCount(threadCount);
+    std::vector<ChainScratch> scratch(threadCount);
+    for (ChainScratch& s : scratch) {
+        s.chain.resize(rankCount);
+    }
+
+    // Chains, grouped by their lowest face (the base); chain c is chains[c * rankCount ...]
+    const int baseRank = ranks[0];
+    const int baseCount = lattice.faceCount(baseRank);
+    std::vector<std::vector<unsigned int>> baseChains(baseCount);
+    parallelFor(baseCount, threadCount, [&](int b, int worker) {
+        scratch[worker].chain[0] = (unsigned int)(lattice.firstFace(baseRank) + b);
+        extendChain(lattice, ranks, rankCount, 1, scratch[worker], baseChains[b]);
+    });
+    std::vector<unsigned int> baseOffsets((size_t)baseCount + 1, 0);
+    for (int b = 0; b < baseCount; b++) {
+        baseOffsets[b + 1] = baseOffsets[b] + (unsigned int)(baseChains[b].size() / rankCount);
+    }
+    const int chainCount = (int)baseOffsets.back();
+    std::vector<unsigned int> chains;
+    chains.reserve((size_t)chainCount * rankCount);
+    for (std::vector<unsigned int>& list : baseChains) {
+        chains.insert(chains.end(), list.begin(), list.end());
+        std::vector<unsigned int>().swap(list);
+    }
+    auto findChain = [&](const unsigned int* chain) {
+        unsigned int base = chain[0] - lattice.firstFace(baseRank);
+        for (unsigned int c = baseOffsets[base]; c < baseOffsets[base + 1]; c++) {
+            if (std::equal(chain, chain + rankCount, &chains[(size_t)c * rankCount])) {
+                return (int)c;
+            }
+        }
+        return -1;
+    };
+
+    // Weights from one flag simplex: the centroids c_0 .. c_(N-1) of a full flag of faces
+    // and the center c_N. The point sum(c_k / h_k) over the ringed ranks, h_k the distance
+    // from c_k to the simplex facet opposite it, is equally far from every ringed mirror.
+    const int vertexCount = lattice.faceCount(0);
+    double center[POLYTOPE_OPERATOR_MAX_DIMS] = {};
+    for (int v = 0; v < vertexCount; v++) {
+        for (int c = 0; c < dims; c++) {
+            center[c] += vertices[(size_t)v * dims + c];
+        }
+    }
+    for (int c = 0; c < dims; c++) {
+        center[c] /= vertexCount;
+    }
+    double inputRadius = 0.0;
+    for (int v = 0; v < vertexCount; v++) {
+        double r = 0.0;
+        for (int c = 0; c < dims; c++) {
+            double x = vertices[(size_t)v * dims + c] - center[c];
+            r += x * x;
+        }
+        inputRadius = std::max(inputRadius, std::sqrt(r));
+    }
+    // flag[k] relative to the center, which is flag[N] = 0 and lies on every facet opposite
+    // a c_k, so the rows spanning that facet are the other c_j themselves
+    double flag[POLYTOPE_OPERATOR_MAX_DIMS][POLYTOPE_OPERATOR_MAX_DIMS];
+    unsigned int flagFace = 0;
+    for (int rank = 0; rank < dims; rank++) {
+        faceCentroid(lattice, vertices, dims, flagFace, flag[rank]);
+        for (int c = 0; c < dims; c++) {
+            flag[rank][c] -= center[c];
+        }
+        if (rank + 1 < dims) {
+            flagFace = lattice.coface(flagFace)[0];
+        }
+    }
+    double weights[POLYTOPE_OPERATOR_MAX_DIMS];
+    std::vector<double> rows;
+    for (int i = 0; i < rankCount; i++) {
+        int k = ranks[i];
+        rows.clear();
+        for (int j = 0; j < dims; j++) {
+            if (j != k) {
+                rows.insert(rows.end(), flag[j], flag[j] + dims);
+            }
+        }
+        double normal[POLYTOPE_OPERATOR_MAX_DIMS];
+        double height = 0.0;
+        if (hyperplaneNormal(rows, dims - 1, dims, 1e-9 * inputRadius, normal)) {
+            for (int c = 0; c < dims; c++) {
+                height += normal[c] * flag[k][c];
+            }
+        }
+        if (std::fabs(height) <= 1e-9 * inputRadius) {
+            std::cout << "ERROR::RINGED_POLYTOPE::DEGENERATE_FLAG" << std::endl;
+            return false;
+        }
+        weights[i] = 1.0 / std::fabs(height);
+    }
+
+    // vertices
+    out.dimensions = dims;
+    out.vertices.resize((size_t)chainCount * dims);
+    std::vector<double> radii(threadCount, 0.0);
+    parallelFor(chainCount, threadCount, [&](int chain, int worker) {
+        double point[POLYTOPE_OPERATOR_MAX_DIMS] = {};
+        double centroid[POLYTOPE_OPERATOR_MAX_DIMS];
+        for (int i = 0; i < rankCount; i++) {
+            faceCentroid(lattice, vertices, dims, chains[(size_t)chain * rankCount + i], centroid);
+            for (int c = 0; c < dims; c++) {
+                point[c] += weights[i] * (centroid[c] - center[c]);
+            }
+        }
+        double radius = 0.0;
+        for (int c = 0; c < dims; c++) {
+            out.vertices[(size_t)chain * dims + c] = (float)point[c];
+            radius += point[c] * point[c];
+        }
+        radii[worker] = std::max(radii[worker], radius);
+    });
+    double outputRadius = std::sqrt(*std::max_element(radii.begin(), radii.end()));
+    double fit = outputRadius > 0.0 ? inputRadius / outputRadius : 1.0;
+    parallelFor(chainCount, threadCount, [&](int chain, int) {
+        for (int c = 0; c < dims; c++) {
+            float& x = out.vertices[(size_t)chain * dims + c];
+            x = (float)(center[c] + x * fit);
+        }
+    });
+
+    // Edges: for ringed rank k, the chain's k-face F and each diamond L < F < U it sits in,
+    // with L and U compatible with the chain's neighbouring faces, swap F for the other
+    // k-face of the diamond. L = the empty face for k = 0, U = the polytope for k = N-1.
+    const unsigned int NO_FACE = 0xFFFFFFFFu;
+    std::vector<std::vector<unsigned long long>> workerEdges(threadCount);
+    parallelFor(chainCount, threadCount, [&](int chain, int worker) {
+        ChainScratch& s = scratch[worker];
+        const unsigned int* faces = &chains[(size_t)chain * rankCount];
+        for (int i = 0; i < rankCount; i++) {
+            int k = ranks[i];
+            unsigned int face = faces[i];
+            s.lows.clear();
+            if (k == 0) {
+                s.lows.push_back(NO_FACE);
+            }
+            else if (rankSlot[k - 1] >= 0) {
+                s.lows.push_back(faces[i - 1]);
+            }
+            else {
+                for (int b = 0; b < lattice.boundaryCount(face); b++) {
+                    unsigned int low = lattice.boundary(face)[b];
+                    if (i == 0 || faceContains(lattice, low, faces[i - 1])) {
+                        s.lows.push_back(low);
+                    }
+                }
+            }
+            s.ups.clear();
+            if (k == dims - 1) {
+                s.ups.push_back(NO_FACE);
+            }
+            else if (rankSlot[k + 1] >= 0) {
+                s.ups.push_back(faces[i + 1]);
+            }
+            else {
+                for (int a = 0; a < lattice.cofaceCount(face); a++) {
+                    unsigned int up = lattice.coface(face)[a];
+                    if (i + 1 == rankCount || faceContains(lattice, faces[i + 1], up)) {
+                        s.ups.push_back(up);
+                    }
+                }
+            }
+
+            for (unsigned int low : s.lows) {
+                for (unsigned int up : s.ups) {
+                    unsigned int other = NO_FACE;
+                    if (low == NO_FACE) {
+                        const unsigned int* ends = lattice.boundary(up);
+                        other = ends[0] == face ? ends[1] : ends[0];
+                    }
+                    else {
+                        for (int a = 0; a < lattice.cofaceCount(low) && other == NO_FACE; a++) {
+                            unsigned int g = lattice.coface(low)[a];
+                            bool inUp = up == NO_FACE
+                                || std::find(lattice.boundary(up), lattice.boundary(up) + lattice.boundaryCount(up), g)
+                                       != lattice.boundary(up) + lattice.boundaryCount(up);
+                            if (g != face && inUp) {
+                                other = g;
+                            }
+                        }
+                    }
+                    if (other == NO_FACE) {
+                        continue;
+                    }
+                    s.chain.assign(faces, faces + rankCount);
+                    s.chain[i] = other;
+                    int neighbour = findChain(s.chain.data());
+                    if (neighbour > chain) {
+                        workerEdges[worker].push_back(((unsigned long long)chain << 32) | (unsigned int)neighbour);
+                    }
+                }
+            }
+        }
+    });
+    std::vector<unsigned long long> edges;
+    for (std::vector<unsigned long long>& list : workerEdges) {
+        edges.insert(edges.end(), list.begin(), list.end());
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    out.edges.resize(edges.size() * 2);
+    for (size_t e = 0; e < edges.size(); e++) {
+        out.edges[2 * e] = (unsigned int)(edges[e] >> 32);
+        out.edges[2 * e + 1] = (unsigned int)(edges[e] & 0xFFFFFFFFu);
+    }
+
+    // Facets: one per k-face G for every k whose removal leaves each side of the rank
+    // sequence (ranks below k, ranks above k) either empty or ringed; it holds the chains
+    // whose faces all lie inside G or contain it.
+    bool facetRank[POLYTOPE_OPERATOR_MAX_DIMS];
+    for (int k = 0; k < dims; k++) {
+        bool ringBelow = (rankMask & ((1u << k) - 1)) != 0;
+        bool ringAbove = (rankMask >> (k + 1)) != 0;
+        facetRank[k] = (k == 0 || ringBelow) && (k == dims - 1 || ringAbove);
+    }
+    std::vector<std::vector<unsigned long long>> workerFacets(threadCount);
+    parallelFor(chainCount, threadCount, [&](int chain, int worker) {
+        ChainScratch& s = scratch[worker];
+        const unsigned int* faces = &chains[(size_t)chain * rankCount];
+        for (int k = 0; k < dims; k++) {
+            if (!facetRank[k]) {
+                continue;
+            }
+            if (rankSlot[k] >= 0) {
+                workerFacets[worker].push_back(((unsigned long long)faces[rankSlot[k]] << 32) | (unsigned int)chain);
+                continue;
+            }
+            int below = -1;
+            int above = -1;
+            for (int i = 0; i < rankCount; i++) {
+                if (ranks[i] < k) {
+                    below = i;
+                }
+                else if (above < 0) {
+                    above = i;
+                }
+            }
+            if (below >= 0) {
+                facesAbove(lattice, faces[below], ranks[below], k, s.candidates, s.next);
+            }
+            else {
+                facesBelow(lattice, faces[above], ranks[above], k, s.candidates, s.next);
+            }
+            for (unsigned int g : s.candidates) {
+                if (below < 0 || above < 0 || faceContains(lattice, faces[above], g)) {
+                    workerFacets[worker].push_back(((unsigned long long)g << 32) | (unsigned int)chain);
+                }
+            }
+        }
+    });
+    // group by face (counting sort), each facet's chains in ascending order
+    const int totalFaces = lattice.totalFaces();
+    std::vector<unsigned int> faceOffsets((size_t)totalFaces + 1, 0);
+    for (const std::vector<unsigned long long>& list : workerFacets) {
+        for (unsigned long long pair : list) {
+            faceOffsets[(pair >> 32) + 1]++;
+        }
+    }
+    for (int f = 0; f < totalFaces; f++) {
+        faceOffsets[f + 1] += faceOffsets[f];
+    }
+    out.facetVertices.resize(faceOffsets.back());
+    {
+        std::vector<unsigned int> fill(faceOffsets.begin(), faceOffsets.end() - 1);
+        for (const std::vector<unsigned long long>& list : workerFacets) {
+            for (unsigned long long pair : list) {
+                out.facetVertices[fill[pair >> 32]++] = (unsigned int)(pair & 0xFFFFFFFFu);
+            }
+        }
+    }
+    out.facetOffsets.assign(1, 0);
+    for (int f = 0; f < totalFaces; f++) {
+        if (faceOffsets[f + 1] > faceOffsets[f]) {
+            std::sort(out.facetVertices.begin() + faceOffsets[f], out.facetVertices.begin() + faceOffsets[f + 1]);
+            out.facetOffsets.push_back(faceOffsets[f + 1]);
+        }
+    }
+    out.lattice.clear();
+    return true;
+}
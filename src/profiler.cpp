@@ -0,0 +1,155 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <glad/glad.h>
+#include <imgui.h>
+#include "trace.h"
+
+FrameProfiler profiler;
+
+const int FrameProfiler::QUERY_RING_SIZE;
+const int FrameProfiler::HISTORY_SIZE;
+const int FrameProfiler::HISTOGRAM_BINS;
+
+static const char* stageNames[PROFILE_STAGE_COUNT] = {
+    "ImGui build",
+    "Rotation",
+    "Slice",
+    "Face sort",
+    "Uniforms",
+    "Draw",
+    "ImGui render",
+    "Swap"
+};
+
+// exponential smoothing factor for the per-stage readouts
+static const float STAGE_SMOOTHING = 0.1f;
+
+static float elapsedMs(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<float, std::milli>(to - from).count();
+}
+
+void FrameProfiler::init() {
+    glGenQueries(QUERY_RING_SIZE * PROFILE_STAGE_COUNT, &queries[0][0]);
+    initialized = true;
+}
+
+void FrameProfiler::cleanup() {
+    if (initialized) {
+        glDeleteQueries(QUERY_RING_SIZE * PROFILE_STAGE_COUNT, &queries[0][0]);
+        initialized = false;
+    }
+}
+
+void FrameProfiler::beginFrame() {
+    Clock::time_point now = Clock::now();
+    if (hasPreviousFrame) {
+        traceComplete("Frame", "frame", traceTimestampUs(frameStart), traceTimestampUs(now) - traceTimestampUs(frameStart));
+        frameTimes[historyHead] = elapsedMs(frameStart, now);
+        historyHead = (historyHead + 1) % HISTORY_SIZE;
+        historyCount = std::min(historyCount + 1, HISTORY_SIZE);
+    }
+    frameStart = now;
+    hasPreviousFrame = true;
+
+    // This slot was last used QUERY_RING_SIZE frames ago; its results are usually ready
+    slot = (int)(frameIndex % QUERY_RING_SIZE);
+    if (initialized) {
+        collectGpuResults(slot);
+    }
+    inFrame = true;
+}
+
+void FrameProfiler::endFrame() {
+    inFrame = false;
+    frameIndex++;
+}
+
+void FrameProfiler::beginStage(ProfileStage stage) {
+    if (!inFrame) {
+        return;
+    }
+    stageStart[stage] = Clock::now();
+    if (initialized && !stageOpen) {
+        glBeginQuery(GL_TIME_ELAPSED, queries[slot][stage]);
+        queryIssued[slot][stage] = true;
+        stageOpen = true;
+    }
+}
+
+void FrameProfiler::endStage(ProfileStage stage) {
+    if (!inFrame) {
+        return;
+    }
+    if (initialized && stageOpen && queryIssued[slot][stage]) {
+        glEndQuery(GL_TIME_ELAPSED);
+        stageOpen = false;
+    }
+    Clock::time_point now = Clock::now();
+    float ms = elapsedMs(stageStart[stage], now);
+    cpuStageMs[stage] += (ms - cpuStageMs[stage]) * STAGE_SMOOTHING;
+    traceComplete(stageNames[stage], "frame", traceTimestampUs(stageStart[stage]), traceTimestampUs(now) - traceTimestampUs(stageStart[stage]));
+}
+
+void FrameProfiler::collectGpuResults(int ringSlot) {
+    for (int stage = 0; stage < PROFILE_STAGE_COUNT; stage++) {
+        if (!queryIssued[ringSlot][stage]) {
+            continue;
+        }
+        GLint available = 0;
+        glGetQueryObjectiv(queries[ringSlot][stage], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available) {
+            GLuint64 ns = 0;
+            glGetQueryObjectui64v(queries[ringSlot][stage], GL_QUERY_RESULT, &ns);
+            float ms = (float)(ns / 1.0e6);
+            gpuStageMs[stage] += (ms - gpuStageMs[stage]) * STAGE_SMOOTHING;
+        }
+        // a result that still isn't ready is dropped; the query object gets reused this frame
+        queryIssued[ringSlot][stage] = false;
+    }
+}
+
+float FrameProfiler::percentile(float p) const {
+    if (historyCount == 0) {
+        return 0.0f;
+    }
+    float sorted[HISTORY_SIZE];
+    std::copy(frameTimes, frameTimes + historyCount, sorted);
+    int index = std::min(historyCount - 1, (int)(p * (historyCount - 1) + 0.5f));
+    std::nth_element(sorted, sorted + index, sorted + historyCount);
+    return sorted[index];
+}
+
+void FrameProfiler::drawImGui() {
+    if (!ImGui::CollapsingHeader("Profiler")) {
+        return;
+    }
+
+    ImGui::Text("p50 %.2f ms", percentile(0.50f));
+    ImGui::Text("p95 %.2f ms", percentile(0.95f));
+    ImGui::Text("p99 %.2f ms", percentile(0.99f));
+
+    // histogram of the rolling window, binned up to the worst frame seen in it
+    float worst = 0.0f;
+    for (int i = 0; i < historyCount; i++) {
+        worst = std::max(worst, frameTimes[i]);
+    }
+    float bins[HISTOGRAM_BINS] = {};
+    if (worst > 0.0f) {
+        for (int i = 0; i < historyCount; i++) {
+            int bin = std::min(HISTOGRAM_BINS - 1, (int)(frameTimes[i] / worst * HISTOGRAM_BINS));
+            bins[bin] += 1.0f;
+        }
+    }
+    char overlay[32];
+    snprintf(overlay, sizeof(overlay), "0 - %.1f ms", worst);
+    ImGui::PlotHistogram("##FrameTimes", bins, HISTOGRAM_BINS, 0, overlay, 0.0f, FLT_MAX, ImVec2(0, 50));
+
+    ImGui::Spacing();
+    ImGui::Text("Stage      CPU / GPU ms");
+    for (int stage = 0; stage < PROFILE_STAGE_COUNT; stage++) {
+        ImGui::Text("%-12s %.2f / %.2f", stageNames[stage], cpuStageMs[stage], gpuStageMs[stage]);
+    }
+}
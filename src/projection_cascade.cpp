@@ -0,0 +1,39 @@
+#include "projection_cascade.h"
+
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+std::vector<CascadeViewport> cascadeViewports(int dimensions, int width, int height) {
+    std::vector<CascadeViewport> viewports;
+    int stages = dimensions - 3;
+    if (stages < 1 || width <= 0 || height <= 0) {
+        return viewports;
+    }
+    // columns for roughly square cells
+    int columns = std::max(1, std::min(stages, (int)std::ceil(std::sqrt((double)stages * width / height))));
+    int rows = (stages + columns - 1) / columns;
+    int cellWidth = width / columns;
+    int cellHeight = height / rows;
+    for (int i = 0; i < stages; i++) {
+        CascadeViewport viewport;
+        viewport.x = (i % columns) * cellWidth;
+        viewport.y = height - (i / columns + 1) * cellHeight;
+        viewport.width = cellWidth;
+        viewport.height = cellHeight;
+        viewport.stage = dimensions - 1 - i;
+        viewports.push_back(viewport);
+    }
+    return viewports;
+}
+
+void drawProjectionCascade(const NDimObjectData& object, Shader& shader, float fovy, int width, int height) {
+    shader.setInt("dimensions", object.dimensions);
+    for (const CascadeViewport& viewport : cascadeViewports(object.dimensions, width, height)) {
+        glViewport(viewport.x, viewport.y, viewport.width, viewport.height);
+        shader.setInt("stage", viewport.stage);
+        shader.setMat4("projection", glm::perspective(glm::radians(fovy), (float)viewport.width / (float)viewport.height, 0.1f, 100.0f));
+        object.draw(shader);
+    }
+    glViewport(0, 0, width, height);
+}
@@ -0,0 +1,689 @@
+#include "quickhull.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include "parallel_for.h"
+#include "polytope_cache.h"
+#include "trace.h"
+
+namespace {
+
+const int MAX_HULL_DIMENSIONS = 16;
+
+// Sorted vertex indices of a ridge, for matching the two facets that share it
+struct RidgeKey {
+    int v[MAX_HULL_DIMENSIONS];
+    int count;
+
+    bool operator==(const RidgeKey& other) const {
+        return count == other.count && std::equal(v, v + count, other.v);
+    }
+};
+
+struct RidgeKeyHash {
+    size_t operator()(const RidgeKey& key) const { return (size_t)fnv1a64(key.v, key.count * sizeof(int)); }
+};
+
+class QuickHull {
+public:
+    QuickHull(const float* input, int pointCount, int dims, int threadCount)
+        : dims(dims), pointCount(pointCount), threadCount(threadCount), points((size_t)pointCount * dims) {
+        double maxAbs = 0.0;
+        for (size_t i = 0; i < points.size(); i++) {
+            points[i] = input[i];
+            maxAbs = std::max(maxAbs, std::fabs(points[i]));
+        }
+        // input is float, so coplanar points are only coplanar to float precision
+        epsilon = 8.0 * FLT_EPSILON * std::max(maxAbs, 1e-30) * dims;
+    }
+
+    bool build();
+    void extract(PolytopeMesh& mesh);
+
+private:
+    struct Facet {
+        bool alive = false;
+        double offset = 0.0;
+        std::vector<int> outside;             // conflict list: points above this facet
+        int furthest = -1;
+        double furthestDistance = 0.0;
+    };
+
+    const double* point(int i) const { return &points[(size_t)i * dims]; }
+    int* facetVertices(int f) { return &vertices[(size_t)f * dims]; }
+    int* facetNeighbours(int f) { return &neighbours[(size_t)f * dims]; }
+    double* facetNormal(int f) { return &normals[(size_t)f * dims]; }
+
+    double distance(int f, int p) const {
+        const double* n = &normals[(size_t)f * dims];
+        const double* x = point(p);
+        double sum = -facets[f].offset;
+        for (int i = 0; i < dims; i++) {
+            sum += n[i] * x[i];
+        }
+        return sum;
+    }
+
+    int allocateFacet();
+    void releaseFacet(int f);
+    bool computePlane(int f);
+    bool initialSimplex(std::vector<int>& simplex);
+    void assignOutside(const std::vector<int>& candidates, const std::vector<int>& targets);
+    bool addPoint(int f);
+
+    int dims;
+    int pointCount;
+    int threadCount;
+    double epsilon;
+    std::vector<double> points;
+    std::vector<double> interior;             // centroid of the initial simplex, inside every facet
+
+    // facet arena: per-slot records plus dims entries per slot in the flat arrays
+    std::vector<Facet> facets;
+    std::vector<int> vertices;
+    std::vector<int> neighbours;              // neighbours[f * dims + i] shares every vertex but the i-th
+    std::vector<double> normals;
+    std::vector<int> freeSlots;
+
+    // per-iteration scratch
+    std::vector<int> visitStamp;
+    std::vector<char> visible;
+    int stamp = 0;
+    std::vector<int> pending;
+};
+
+int QuickHull::allocateFacet() {
+    int f;
+    if (!freeSlots.empty()) {
+        f = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else {
+        f = (int)facets.size();
+        facets.emplace_back();
+        vertices.resize(vertices.size() + dims);
+        neighbours.resize(neighbours.size() + dims);
+        normals.resize(normals.size() + dims);
+        visitStamp.push_back(0);
+        visible.push_back(0);
+    }
+    facets[f].alive = true;
+    facets[f].outside.clear();
+    facets[f].furthest = -1;
+    facets[f].furthestDistance = 0.0;
+    return f;
+}
+
+void QuickHull::releaseFacet(int f) {
+    facets[f].alive = false;
+    facets[f].outside.clear();
+    freeSlots.push_back(f);
+}
+
+// Hyperplane through the facet's vertices: the null vector of the (dims-1) x dims matrix of
+// edge vectors, by Gaussian elimination with partial pivoting, oriented away from the interior
+bool QuickHull::computePlane(int f) {
+    const int* v = facetVertices(f);
+    double m[MAX_HULL_DIMENSIONS][MAX_HULL_DIMENSIONS];
+    const double* origin = point(v[0]);
+    for (int r = 0; r + 1 < dims; r++) {
+        const double* p = point(v[r + 1]);
+        for (int c = 0; c < dims; c++) {
+            m[r][c] = p[c] - origin[c];
+        }
+    }
+
+    int pivotColumn[MAX_HULL_DIMENSIONS];
+    bool isPivot[MAX_HULL_DIMENSIONS] = {};
+    int rows = dims - 1;
+    for (int r = 0; r < rows; r++) {
+        int bestRow = r;
+        int bestColumn = -1;
+        double best = 0.0;
+        for (int i = r; i < rows; i++) {
+            for (int c = 0; c < dims; c++) {
+                if (!isPivot[c] && std::fabs(m[i][c]) > best) {
+                    best = std::fabs(m[i][c]);
+                    bestRow = i;
+                    bestColumn = c;
+                }
+            }
+        }
+        if (bestColumn < 0 || best < epsilon) {
+            return false;
+        }
+        for (int c = 0; c < dims; c++) {
+            std::swap(m[r][c], m[bestRow][c]);
+        }
+        pivotColumn[r] = bestColumn;
+        isPivot[bestColumn] = true;
+        for (int i = 0; i < rows; i++) {
+            if (i == r) {
+                continue;
+            }
+            double factor = m[i][bestColumn] / m[r][bestColumn];
+            for (int c = 0; c < dims; c++) {
+                m[i][c] -= factor * m[r][c];
+            }
+        }
+    }
+
+    // the one free column gets 1; the pivot columns follow from the reduced rows
+    double* n = facetNormal(f);
+    int freeColumn = 0;
+    while (isPivot[freeColumn]) {
+        freeColumn++;
+    }
+    for (int c = 0; c < dims; c++) {
+        n[c] = 0.0;
+    }
+    n[freeColumn] = 1.0;
+    for (int r = 0; r < rows; r++) {
+        n[pivotColumn[r]] = -m[r][freeColumn] / m[r][pivotColumn[r]];
+    }
+
+    double length = 0.0;
+    for (int c = 0; c < dims; c++) {
+        length += n[c] * n[c];
+    }
+    length = std::sqrt(length);
+    double offset = 0.0;
+    double side = 0.0;
+    for (int c = 0; c < dims; c++) {
+        n[c] /= length;
+        offset += n[c] * origin[c];
+        side += n[c] * interior[c];
+    }
+    if (side > offset) {
+        for (int c = 0; c < dims; c++) {
+            n[c] = -n[c];
+        }
+        offset = -offset;
+    }
+    facets[f].offset = offset;
+    return true;
+}
+
+// dims + 1 affinely independent points: greedily the point furthest from the span so far
+bool QuickHull::initialSimplex(std::vector<int>& simplex) {
+    int first = 0;
+    for (int i = 1; i < pointCount; i++) {
+        if (point(i)[0] < point(first)[0]) {
+            first = i;
+        }
+    }
+    simplex.assign(1, first);
+
+    std::vector<double> basis;                // orthonormal directions spanned so far
+    std::vector<double> residual(dims);
+    for (int k = 1; k <= dims; k++) {
+        int best = -1;
+        double bestDistance = 0.0;
+        for (int i = 0; i < pointCount; i++) {
+            for (int c = 0; c < dims; c++) {
+                residual[c] = point(i)[c] - point(first)[c];
+            }
+            for (int b = 0; b + 1 < k; b++) {
+                const double* e = &basis[(size_t)b * dims];
+                double dot = 0.0;
+                for (int c = 0; c < dims; c++) {
+                    dot += residual[c] * e[c];
+                }
+                for (int c = 0; c < dims; c++) {
+                    residual[c] -= dot * e[c];
+                }
+            }
+            double d = 0.0;
+            for (int c = 0; c < dims; c++) {
+                d += residual[c] * residual[c];
+            }
+            if (d > bestDistance) {
+                bestDistance = d;
+                best = i;
+            }
+        }
+        if (best < 0 || std::sqrt(bestDistance) <= epsilon * 100.0) {
+            return false;
+        }
+        simplex.push_back(best);
+        for (int c = 0; c < dims; c++) {
+            residual[c] = point(best)[c] - point(first)[c];
+        }
+        for (int b = 0; b + 1 < k; b++) {
+            const double* e = &basis[(size_t)b * dims];
+            double dot = 0.0;
+            for (int c = 0; c < dims; c++) {
+                dot += residual[c] * e[c];
+            }
+            for (int c = 0; c < dims; c++) {
+                residual[c] -= dot * e[c];
+            }
+        }
+        double length = std::sqrt(bestDistance);
+        for (int c = 0; c < dims; c++) {
+            basis.push_back(residual[c] / length);
+        }
+    }
+    return true;
+}
+
+// Give each candidate point to the first target facet it is above (in parallel), and
+// drop the points that are above none
+void QuickHull::assignOutside(const std::vector<int>& candidates, const std::vector<int>& targets) {
+    std::vector<int> owner(candidates.size());
+    std::vector<double> ownerDistance(candidates.size());
+    parallelFor((int)candidates.size(), threadCount, [&](int i, int) {
+        owner[i] = -1;
+        for (int f : targets) {
+            double d = distance(f, candidates[i]);
+            if (d > epsilon) {
+                owner[i] = f;
+                ownerDistance[i] = d;
+                break;
+            }
+        }
+    });
+    for (size_t i = 0; i < candidates.size(); i++) {
+        int f = owner[i];
+        if (f < 0) {
+            continue;
+        }
+        facets[f].outside.push_back(candidates[i]);
+        if (ownerDistance[i] > facets[f].furthestDistance) {
+            facets[f].furthestDistance = ownerDistance[i];
+            facets[f].furthest = candidates[i];
+        }
+    }
+}
+
+bool QuickHull::build() {
+    std::vector<int> simplex;
+    if (!initialSimplex(simplex)) {
+        std::cout << "ERROR::QUICKHULL::DEGENERATE_INPUT points do not span " << dims << " dimensions" << std::endl;
+        return false;
+    }
+    interior.assign(dims, 0.0);
+    for (int s : simplex) {
+        for (int c = 0; c < dims; c++) {
+            interior[c] += point(s)[c] / (dims + 1);
+        }
+    }
+
+    // facet i of the simplex omits simplex vertex i; across its vertex s_j lies facet j
+    std::vector<int> initial;
+    for (int i = 0; i <= dims; i++) {
+        initial.push_back(allocateFacet());
+    }
+    for (int i = 0; i <= dims; i++) {
+        int f = initial[i];
+        int position = 0;
+        for (int j = 0; j <= dims; j++) {
+            if (j != i) {
+                facetVertices(f)[position] = simplex[j];
+                facetNeighbours(f)[position] = initial[j];
+                position++;
+            }
+        }
+        computePlane(f);
+    }
+
+    std::vector<int> candidates;
+    std::vector<char> inSimplex(pointCount, 0);
+    for (int s : simplex) {
+        inSimplex[s] = 1;
+    }
+    for (int i = 0; i < pointCount; i++) {
+        if (!inSimplex[i]) {
+            candidates.push_back(i);
+        }
+    }
+    assignOutside(candidates, initial);
+    pending = initial;
+
+    while (!pending.empty()) {
+        int f = pending.back();
+        pending.pop_back();
+        if (facets[f].alive && !facets[f].outside.empty()) {
+            if (!addPoint(f)) {
+                std::cout << "ERROR::QUICKHULL::NUMERICAL_FAILURE" << std::endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool QuickHull::addPoint(int start) {
+    int eye = facets[start].furthest;
+
+    // visible facets by flood fill from the start facet; horizon ridges are (facet, position)
+    // pairs whose neighbour is not visible
+    stamp++;
+    std::vector<int> visibleFacets(1, start);
+    std::vector<std::pair<int, int>> horizon;
+    visitStamp[start] = stamp;
+    visible[start] = 1;
+    for (size_t i = 0; i < visibleFacets.size(); i++) {
+        int f = visibleFacets[i];
+        for (int j = 0; j < dims; j++) {
+            int g = facetNeighbours(f)[j];
+            if (visitStamp[g] != stamp) {
+                visitStamp[g] = stamp;
+                visible[g] = distance(g, eye) > epsilon;
+                if (visible[g]) {
+                    visibleFacets.push_back(g);
+                }
+            }
+            if (!visible[g]) {
+                horizon.push_back(std::make_pair(f, j));
+            }
+        }
+    }
+
+    // cone each horizon ridge to the eye; the new facet keeps the ridge's slot order, with
+    // the eye in place of the dropped vertex, so its neighbour there is the hidden facet
+    std::vector<int> created;
+    std::unordered_map<RidgeKey, std::pair<int, int>, RidgeKeyHash> openRidges;
+    for (const std::pair<int, int>& ridge : horizon) {
+        int f = ridge.first;
+        int j = ridge.second;
+        int hidden = facetNeighbours(f)[j];
+        int n = allocateFacet();
+        created.push_back(n);
+        for (int i = 0; i < dims; i++) {
+            facetVertices(n)[i] = i == j ? eye : facetVertices(f)[i];
+        }
+        facetNeighbours(n)[j] = hidden;
+        for (int i = 0; i < dims; i++) {
+            if (facetNeighbours(hidden)[i] == f) {
+                facetNeighbours(hidden)[i] = n;
+            }
+        }
+
+        // the other ridges of the new facet all contain the eye and are shared with another new facet
+        for (int m = 0; m < dims; m++) {
+            if (m == j) {
+                continue;
+            }
+            RidgeKey key;
+            key.count = 0;
+            for (int i = 0; i < dims; i++) {
+                if (i != m) {
+                    key.v[key.count++] = facetVertices(n)[i];
+                }
+            }
+            std::sort(key.v, key.v + key.count);
+            auto found = openRidges.find(key);
+            if (found == openRidges.end()) {
+                openRidges[key] = std::make_pair(n, m);
+            }
+            else {
+                facetNeighbours(n)[m] = found->second.first;
+                facetNeighbours(found->second.first)[found->second.second] = n;
+                openRidges.erase(found);
+            }
+        }
+    }
+    if (!openRidges.empty()) {
+        return false;
+    }
+    std::vector<char> planeOk(created.size());
+    parallelFor((int)created.size(), threadCount, [&](int i, int) {
+        planeOk[i] = computePlane(created[i]);
+    });
+    if (std::find(planeOk.begin(), planeOk.end(), 0) != planeOk.end()) {
+        return false;
+    }
+
+    // the visible facets' conflict points move to the new facets (or are now inside)
+    std::vector<int> orphans;
+    for (int f : visibleFacets) {
+        for (int p : facets[f].outside) {
+            if (p != eye) {
+                orphans.push_back(p);
+            }
+        }
+        releaseFacet(f);
+    }
+    assignOutside(orphans, created);
+    for (int n : created) {
+        if (!facets[n].outside.empty()) {
+            pending.push_back(n);
+        }
+    }
+    return true;
+}
+
+void QuickHull::extract(PolytopeMesh& mesh) {
+    // merge adjacent coplanar simplices into true facets (union-find over alive slots)
+    std::vector<int> parent(facets.size());
+    for (size_t f = 0; f < facets.size(); f++) {
+        parent[f] = (int)f;
+    }
+    auto root = [&parent](int f) {
+        while (parent[f] != f) {
+            parent[f] = parent[parent[f]];
+            f = parent[f];
+        }
+        return f;
+    };
+    for (int f = 0; f < (int)facets.size(); f++) {
+        if (!facets[f].alive) {
+            continue;
+        }
+        for (int j = 0; j < dims; j++) {
+            // neighbours share all but one vertex, so they are coplanar when that one is on f's plane
+            int g = facetNeighbours(f)[j];
+            int apex = -1;
+            for (int i = 0; i < dims; i++) {
+                int v = facetVertices(g)[i];
+                if (std::find(facetVertices(f), facetVertices(f) + dims, v) == facetVertices(f) + dims) {
+                    apex = v;
+                }
+            }
+            if (apex >= 0 && std::fabs(distance(f, apex)) <= epsilon) {
+                parent[root(f)] = root(g);
+            }
+        }
+    }
+    std::unordered_map<int, std::vector<int>> merged;
+    for (int f = 0; f < (int)facets.size(); f++) {
+        if (facets[f].alive) {
+            std::vector<int>& set = merged[root(f)];
+            set.insert(set.end(), facetVertices(f), facetVertices(f) + dims);
+        }
+    }
+    std::vector<std::vector<int>> trueFacets;
+    for (auto& entry : merged) {
+        std::vector<int>& set = entry.second;
+        std::sort(set.begin(), set.end());
+        set.erase(std::unique(set.begin(), set.end()), set.end());
+        trueFacets.push_back(set);
+    }
+    std::sort(trueFacets.begin(), trueFacets.end());
+
+    // vertex -> true facets
+    std::unordered_map<int, std::vector<int>> incident;
+    for (int f = 0; f < (int)trueFacets.size(); f++) {
+        for (int v : trueFacets[f]) {
+            incident[v].push_back(f);
+        }
+    }
+    // a face is the intersection of the facets containing it, so a vertex set S is a face
+    // exactly when intersecting every facet through S gives back S
+    auto closure = [&](const std::vector<int>& set, std::vector<int>& out) {
+        const std::vector<int>& through = incident[set[0]];
+        out.clear();
+        bool first = true;
+        for (int f : through) {
+            if (!std::includes(trueFacets[f].begin(), trueFacets[f].end(), set.begin(), set.end())) {
+                continue;
+            }
+            if (first) {
+                out = trueFacets[f];
+                first = false;
+            }
+            else {
+                std::vector<int> next;
+                std::set_intersection(out.begin(), out.end(), trueFacets[f].begin(), trueFacets[f].end(), std::back_inserter(next));
+                out.swap(next);
+            }
+        }
+    };
+
+    // simplices added during the build can end up inside a merged facet; only points whose
+    // closure is themselves are vertices
+    std::vector<int> hullVertices;
+    std::vector<int> single(1), closed;
+    for (auto& entry : incident) {
+        single[0] = entry.first;
+        closure(single, closed);
+        if (closed.size() == 1) {
+            hullVertices.push_back(entry.first);
+        }
+    }
+    std::sort(hullVertices.begin(), hullVertices.end());
+    std::unordered_map<int, unsigned int> remap;
+    for (size_t i = 0; i < hullVertices.size(); i++) {
+        remap[hullVertices[i]] = (unsigned int)i;
+    }
+
+    // edges: every vertex pair of a simplicial facet; pairs in larger facets must close to
+    // themselves, ignoring points that are not vertices (e.g. on the segment between them)
+    auto isVertex = [&remap](int v) { return remap.count(v) != 0; };
+    std::unordered_set<unsigned long long> edgeSet;
+    std::vector<unsigned int> edges;
+    std::vector<int> pair(2);
+    for (const std::vector<int>& facet : trueFacets) {
+        for (size_t a = 0; a < facet.size(); a++) {
+            for (size_t b = a + 1; b < facet.size(); b++) {
+                if (!remap.count(facet[a]) || !remap.count(facet[b])) {
+                    continue;
+                }
+                unsigned long long key = ((unsigned long long)facet[a] << 32) | (unsigned int)facet[b];
+                if (edgeSet.count(key)) {
+                    continue;
+                }
+                if ((int)facet.size() > dims) {
+                    pair[0] = facet[a];
+                    pair[1] = facet[b];
+                    closure(pair, closed);
+                    if (std::count_if(closed.begin(), closed.end(), isVertex) != 2) {
+                        continue;
+                    }
+                }
+                edgeSet.insert(key);
+                edges.push_back(remap[facet[a]]);
+                edges.push_back(remap[facet[b]]);
+            }
+        }
+    }
+
+    mesh.dimensions = dims;
+    mesh.vertices.resize(hullVertices.size() * dims);
+    for (size_t i = 0; i < hullVertices.size(); i++) {
+        for (int c = 0; c < dims; c++) {
+            mesh.vertices[i * dims + c] = (float)point(hullVertices[i])[c];
+        }
+    }
+    mesh.edges.swap(edges);
+    mesh.facetOffsets.assign(1, 0);
+    mesh.facetVertices.clear();
+    for (const std::vector<int>& facet : trueFacets) {
+        for (int v : facet) {
+            auto found = remap.find(v);
+            if (found != remap.end()) {
+                mesh.facetVertices.push_back(found->second);
+            }
+        }
+        mesh.facetOffsets.push_back((unsigned int)mesh.facetVertices.size());
+    }
+    mesh.lattice.clear();
+}
+
+} // namespace
+
+void generateSpherePoints(int dims, int count, unsigned int seed, std::vector<float>& points) {
+    std::mt19937 random(seed);
+    std::normal_distribution<double> gaussian(0.0, 1.0);
+    points.resize((size_t)count * dims);
+    for (int i = 0; i < count; i++) {
+        double p[MAX_HULL_DIMENSIONS];
+        double length = 0.0;
+        do {
+            length = 0.0;
+            for (int c = 0; c < dims; c++) {
+                p[c] = gaussian(random);
+                length += p[c] * p[c];
+            }
+        } while (length < 1e-12);
+        length = std::sqrt(length);
+        for (int c = 0; c < dims; c++) {
+            points[(size_t)i * dims + c] = (float)(p[c] / length);
+        }
+    }
+}
+
+bool loadPointSet(const std::string& path, int& dims, std::vector<float>& points) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cout << "ERROR::POINT_SET::FILE_NOT_SUCCESSFULLY_READ " << path << std::endl;
+        return false;
+    }
+    dims = 0;
+    points.clear();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream stream(line);
+        std::vector<float> coordinates;
+        float value;
+        while (stream >> value) {
+            coordinates.push_back(value);
+        }
+        if (!stream.eof()) {
+            std::cout << "ERROR::POINT_SET::BAD_NUMBER " << path << ":" << lineNumber << std::endl;
+            return false;
+        }
+        if (coordinates.empty()) {
+            continue;
+        }
+        if (dims == 0) {
+            dims = (int)coordinates.size();
+        }
+        if ((int)coordinates.size() != dims || dims > MAX_HULL_DIMENSIONS) {
+            std::cout << "ERROR::POINT_SET::BAD_DIMENSIONS " << path << ":" << lineNumber << std::endl;
+            return false;
+        }
+        points.insert(points.end(), coordinates.begin(), coordinates.end());
+    }
+    return dims > 0;
+}
+
+bool computeConvexHull(const float* points, int pointCount, int dims, PolytopeMesh& mesh, int threadCount) {
+    TraceScope trace("Convex hull", "geometry");
+    if (dims < 2 || dims > MAX_HULL_DIMENSIONS || pointCount <= dims) {
+        std::cout << "ERROR::QUICKHULL::TOO_FEW_POINTS" << std::endl;
+        return false;
+    }
+    QuickHull hull(points, pointCount, dims, threadCount);
+    if (!hull.build()) {
+        return false;
+    }
+    hull.extract(mesh);
+    return true;
+}
@@ -0,0 +1,76 @@
+#include "radix_sort.h"
+
+#include <algorithm>
+#include <cstddef>
+#include "parallel_for.h"
+
+namespace {
+
+const int RADIX_BITS = 8;
+const int RADIX = 1 << RADIX_BITS;
+
+// Keys per chunk; parallelFor hands out chunks in blocks of 16, so threads join in from 32K keys
+const size_t CHUNK_SIZE = 1024;
+
+} // namespace
+
+void radixSortPairs(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, RadixSortScratch& scratch, int threadCount) {
+    const size_t count = keys.size();
+    if (count < 2) {
+        return;
+    }
+    const int chunks = (int)((count + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    scratch.keys.resize(count);
+    scratch.values.resize(count);
+    scratch.counts.resize((size_t)chunks * RADIX);
+
+    uint32_t* sourceKeys = keys.data();
+    uint32_t* sourceValues = values.data();
+    uint32_t* targetKeys = scratch.keys.data();
+    uint32_t* targetValues = scratch.values.data();
+    uint32_t* counts = scratch.counts.data();
+
+    for (int shift = 0; shift < 32; shift += RADIX_BITS) {
+        parallelFor(chunks, threadCount, [&](int c, int) {
+            uint32_t* histogram = counts + (size_t)c * RADIX;
+            std::fill(histogram, histogram + RADIX, 0u);
+            size_t end = std::min(count, (c + 1) * CHUNK_SIZE);
+            for (size_t i = c * CHUNK_SIZE; i < end; i++) {
+                histogram[(sourceKeys[i] >> shift) & (RADIX - 1)]++;
+            }
+        });
+
+        // digit-major prefix sum: equal digits keep their chunk order, which keeps the sort stable
+        uint32_t offset = 0;
+        bool uniform = false;
+        for (int d = 0; d < RADIX && !uniform; d++) {
+            uint32_t digitStart = offset;
+            for (int c = 0; c < chunks; c++) {
+                uint32_t n = counts[(size_t)c * RADIX + d];
+                counts[(size_t)c * RADIX + d] = offset;
+                offset += n;
+            }
+            uniform = offset - digitStart == count;
+        }
+        if (uniform) {
+            continue;
+        }
+
+        parallelFor(chunks, threadCount, [&](int c, int) {
+            uint32_t* next = counts + (size_t)c * RADIX;
+            size_t end = std::min(count, (c + 1) * CHUNK_SIZE);
+            for (size_t i = c * CHUNK_SIZE; i < end; i++) {
+                uint32_t slot = next[(sourceKeys[i] >> shift) & (RADIX - 1)]++;
+                targetKeys[slot] = sourceKeys[i];
+                targetValues[slot] = sourceValues[i];
+            }
+        });
+        std::swap(sourceKeys, targetKeys);
+        std::swap(sourceValues, targetValues);
+    }
+
+    if (sourceKeys != keys.data()) {
+        keys.swap(scratch.keys);
+        values.swap(scratch.values);
+    }
+}
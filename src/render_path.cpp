@@ -0,0 +1,173 @@
+#include "render_path.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include "trace.h"
+
+namespace {
+
+const char* const FRAGMENT_SHADERS[RENDER_PATH_COUNT] = {
+    "shaders/ws-coloring.f",
+    "shaders/color-from-height.f",
+    "shaders/oit-accumulate.f",
+    "shaders/oit-accumulate.f"
+};
+
+// lines and sprites share one fragment stage for every path
+const char* const COVERAGE_FRAGMENT_SHADER = "shaders/coverage.f";
+const char* const LINE_VERTEX_SHADER = "shaders/thick-lines.v";
+const char* const SPRITE_VERTEX_SHADER = "shaders/vertex-sprites.v";
+const char* const GALLERY_VERTEX_SHADER = "shaders/gallery.v";
+const char* const INSTANCED_VERTEX_SHADER = "shaders/instanced.v";
+const char* const CASCADE_VERTEX_SHADER = "shaders/cascade.v";
+const char* const SCATTER_MATRIX_VERTEX_SHADER = "shaders/scatter-matrix.v";
+
+// (vertex shader path, path) -> program
+std::map<std::pair<std::string, int>, Shader*> variants;
+
+Shader* variant(const char* vertexPath, const char* fragmentPath, RenderPath path) {
+    Shader*& shader = variants[std::make_pair(std::string(vertexPath), (int)path)];
+    if (shader == nullptr) {
+        TraceScope trace("Shader compile", "gl");
+        shader = new Shader(vertexPath, fragmentPath);
+        shader->use();
+        shader->setBool("depthWeighted", path == RENDER_PATH_OIT);
+        shader->setBool("heightColoring", path == RENDER_PATH_HEIGHT);
+        shader->setBool("accumulate", renderPathTransparent(path));
+    }
+    return shader;
+}
+
+} // namespace
+
+const char* renderPathName(RenderPath path) {
+    static const char* const names[RENDER_PATH_COUNT] = { "position", "height", "oit", "density" };
+    return path >= 0 && path < RENDER_PATH_COUNT ? names[path] : "unknown";
+}
+
+Shader* renderPathShader(const NDimObjectData& object, RenderPath path) {
+    if (path == RENDER_PATH_POSITION) {
+        return object.shader;
+    }
+    return variant(object.shaderVertPath, FRAGMENT_SHADERS[path], path);
+}
+
+Shader* renderPathLineShader(RenderPath path) {
+    return variant(LINE_VERTEX_SHADER, COVERAGE_FRAGMENT_SHADER, path);
+}
+
+Shader* renderPathSpriteShader(RenderPath path) {
+    return variant(SPRITE_VERTEX_SHADER, COVERAGE_FRAGMENT_SHADER, path);
+}
+
+Shader* renderPathGalleryShader(RenderPath path) {
+    return variant(GALLERY_VERTEX_SHADER, FRAGMENT_SHADERS[path], path);
+}
+
+Shader* renderPathInstancedShader(RenderPath path) {
+    return variant(INSTANCED_VERTEX_SHADER, FRAGMENT_SHADERS[path], path);
+}
+
+Shader* renderPathCascadeShader(RenderPath path) {
+    return variant(CASCADE_VERTEX_SHADER, FRAGMENT_SHADERS[path], path);
+}
+
+Shader* renderPathScatterMatrixShader(RenderPath path) {
+    return variant(SCATTER_MATRIX_VERTEX_SHADER, FRAGMENT_SHADERS[path], path);
+}
+
+void cleanupRenderPathShaders() {
+    for (auto& entry : variants) {
+        glDeleteProgram(entry.second->ID);
+        delete entry.second;
+    }
+    variants.clear();
+}
+
+void TransparencyTargets::init() {
+    composite = new Shader("shaders/oit-composite.v", "shaders/oit-composite.f");
+    composite->use();
+    composite->setInt("accumulation", 0);
+    composite->setInt("weights", 1);
+    glGenVertexArrays(1, &VAO);
+    glGenFramebuffers(1, &FBO);
+    glGenTextures(1, &accumulationTexture);
+    glGenTextures(1, &weightTexture);
+    width = height = 0;
+}
+
+void TransparencyTargets::cleanup() {
+    if (composite != nullptr) {
+        glDeleteProgram(composite->ID);
+        delete composite;
+        composite = nullptr;
+    }
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteFramebuffers(1, &FBO);
+    glDeleteTextures(1, &accumulationTexture);
+    glDeleteTextures(1, &weightTexture);
+    VAO = FBO = accumulationTexture = weightTexture = 0;
+}
+
+void TransparencyTargets::begin(RenderPath renderPath, int targetWidth, int targetHeight) {
+    path = renderPath;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+    glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+
+    if (targetWidth != width || targetHeight != height) {
+        TraceScope trace("Transparency targets", "gl");
+        width = targetWidth;
+        height = targetHeight;
+        const GLenum formats[2] = { GL_RGBA16F, GL_R16F };
+        const unsigned int textures[2] = { accumulationTexture, weightTexture };
+        for (int i = 0; i < 2; i++) {
+            glBindTexture(GL_TEXTURE_2D, textures[i]);
+            glTexImage2D(GL_TEXTURE_2D, 0, formats[i], width, height, 0, i == 0 ? GL_RGBA : GL_RED, GL_HALF_FLOAT, nullptr);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, textures[i], 0);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+        const GLenum drawBuffers[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+        glDrawBuffers(2, drawBuffers);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cout << "ERROR::TRANSPARENCY::FRAMEBUFFER_INCOMPLETE" << std::endl;
+        }
+    }
+
+    const float clearAccumulation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    const float clearWeight[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    glClearBufferfv(GL_COLOR, 0, clearAccumulation);
+    glClearBufferfv(GL_COLOR, 1, clearWeight);
+
+    // color and weight add up; the alpha channel multiplies down to the revealage (1 - alpha products)
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glEnable(GL_BLEND);
+    glBlendFuncSeparate(GL_ONE, GL_ONE, GL_ZERO, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void TransparencyTargets::resolve(float exposure) {
+    glBindFramebuffer(GL_FRAMEBUFFER, target);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    composite->use();
+    composite->setBool("density", path == RENDER_PATH_DENSITY);
+    composite->setFloat("exposure", exposure);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, accumulationTexture);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, weightTexture);
+    glBindVertexArray(VAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_DEPTH_TEST);
+}
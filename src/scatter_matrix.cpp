@@ -0,0 +1,28 @@
+#include "scatter_matrix.h"
+
+#include <algorithm>
+
+void drawScatterMatrix(const NDimObjectData& object, Shader& shader, int width, int height) {
+    int panels = scatterMatrixPanels(object.dimensions);
+    if (panels == 0 || object.vertexCount == 0 || width <= 0 || height <= 0) {
+        return;
+    }
+    float aspect = (float)width / (float)height;
+
+    shader.setInt("dimensions", object.dimensions);
+    shader.setFloat("positionScale", object.positionScale);
+    // rotations keep lengths, so no rotated coordinate exceeds the circumradius
+    shader.setFloat("extent", object.circumradius > 0.0f ? object.circumradius : 1.0f);
+    shader.setVec2("gridHalfSize", 0.95f * std::min(1.0f, 1.0f / aspect), 0.95f * std::min(1.0f, aspect));
+
+    // flat panels: points overlap in draw order
+    GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+    glDisable(GL_DEPTH_TEST);
+    glBindVertexArray(object.VAO);
+    glPointSize(VERTEX_SIZE);
+    glDrawArraysInstanced(GL_POINTS, 0, object.vertexCount, panels);
+    glBindVertexArray(0);
+    if (depthTest) {
+        glEnable(GL_DEPTH_TEST);
+    }
+}
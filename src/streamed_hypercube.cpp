@@ -0,0 +1,315 @@
+#include "streamed_hypercube.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "projection.h"
+#include "trace.h"
+
+namespace {
+
+// Every projection step divides by roughly PROJECTION_DISTANCE, so undo that and
+// normalize by the circumradius to keep the cube about the same size at any N
+float streamScale(int dimensions) {
+    float circumradius = 0.5f * std::sqrt((float)dimensions);
+    return 1.2f * std::pow(PROJECTION_DISTANCE, (float)(dimensions - 3)) / circumradius;
+}
+
+// The 8D hypercube's planes, then one extra plane per further pair of axes
+void makeStreamPlanes(int dimensions, std::vector<RotationPlane>& planes) {
+    static const RotationPlane basePlanes[] = {
+        {1, 3, 0.38f},
+        {0, 4, 0.28f},
+        {2, 5, 0.23f},
+        {6, 7, 0.18f}
+    };
+    planes.clear();
+    for (const RotationPlane& plane : basePlanes) {
+        if (plane.axis2 < dimensions) {
+            planes.push_back(plane);
+        }
+    }
+    float speed = 0.18f;
+    for (int axis = 8; axis + 1 < dimensions; axis += 2) {
+        speed *= 0.85f;
+        RotationPlane plane = { axis, axis + 1, speed };
+        planes.push_back(plane);
+    }
+}
+
+int lowestSetBit(long long value) {
+    int bit = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        bit++;
+    }
+    return bit;
+}
+
+void worldOrOrigin(const float* rotated, int dims, float scale, float* world) {
+    if (!projectToWorld(rotated, dims, scale, world)) {
+        world[0] = world[1] = world[2] = 0.0f;
+    }
+}
+
+} // namespace
+
+void prepareStreamFrame(HypercubeStreamFrame& frame, int dimensions, const float* rotation, float scale) {
+    frame.dimensions = dimensions;
+    frame.halfEdge = 0.5f;
+    frame.scale = scale;
+    for (int j = 0; j < dimensions; j++) {
+        for (int i = 0; i < dimensions; i++) {
+            frame.columns[j * dimensions + i] = rotation[i * dimensions + j];
+        }
+    }
+}
+
+int streamVerticesPerChunk(int dimensions) {
+    return std::max(1, STREAM_CHUNK_EDGES / dimensions);
+}
+
+int generateHypercubeChunk(const HypercubeStreamFrame& frame, long long firstVertex, int vertexCount, float* out) {
+    const int dims = frame.dimensions;
+    const float h = frame.halfEdge;
+
+    // rotated position of the first vertex: sum of +-h times each rotation column
+    long long gray = firstVertex ^ (firstVertex >> 1);
+    float rotated[STREAM_MAX_DIMENSIONS];
+    for (int i = 0; i < dims; i++) {
+        rotated[i] = 0.0f;
+    }
+    for (int j = 0; j < dims; j++) {
+        float sign = (gray >> j) & 1 ? h : -h;
+        const float* column = frame.columns + j * dims;
+        for (int i = 0; i < dims; i++) {
+            rotated[i] += sign * column[i];
+        }
+    }
+
+    int edges = 0;
+    float neighbour[STREAM_MAX_DIMENSIONS];
+    for (int v = 0; v < vertexCount; v++) {
+        if (v > 0) {
+            // next Gray code differs in one bit, so the rotated position moves by one column
+            int bit = lowestSetBit(firstVertex + v);
+            gray ^= 1LL << bit;
+            float step = (gray >> bit) & 1 ? 2.0f * h : -2.0f * h;
+            const float* column = frame.columns + bit * dims;
+            for (int i = 0; i < dims; i++) {
+                rotated[i] += step * column[i];
+            }
+        }
+
+        float world[3];
+        worldOrOrigin(rotated, dims, frame.scale, world);
+
+        for (int j = 0; j < dims; j++) {
+            if ((gray >> j) & 1) {
+                continue;
+            }
+            const float* column = frame.columns + j * dims;
+            for (int i = 0; i < dims; i++) {
+                neighbour[i] = rotated[i] + 2.0f * h * column[i];
+            }
+            float* edge = out + (size_t)edges * 6;
+            edge[0] = world[0];
+            edge[1] = world[1];
+            edge[2] = world[2];
+            worldOrOrigin(neighbour, dims, frame.scale, edge + 3);
+            edges++;
+        }
+    }
+    return edges;
+}
+
+void StreamedHypercube::init(int dimensions) {
+    object.name = "Streamed Hypercube";
+    object.renderEdges = true;
+    object.shaderVertPath = "shaders/3d.v";          // vertices arrive already projected to 3D
+    object.shaderFragPath = "shaders/ws-coloring.f";
+    setDimensions(dimensions);
+    object.initShader();
+
+    size_t ringBytes = (size_t)STREAM_CHUNK_EDGES * 6 * sizeof(float);
+    glGenVertexArrays(STREAM_RING_SIZE, ringVAO);
+    glGenBuffers(STREAM_RING_SIZE, ringVBO);
+    for (int i = 0; i < STREAM_RING_SIZE; i++) {
+        glBindVertexArray(ringVAO[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, ringVBO[i]);
+        glBufferData(GL_ARRAY_BUFFER, ringBytes, nullptr, GL_STREAM_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    }
+    glBindVertexArray(0);
+
+    startWorkers();
+}
+
+void StreamedHypercube::cleanup() {
+    stopWorkers();
+    for (int i = 0; i < STREAM_RING_SIZE; i++) {
+        if (ringFence[i] != nullptr) {
+            glDeleteSync(ringFence[i]);
+            ringFence[i] = nullptr;
+        }
+    }
+    glDeleteVertexArrays(STREAM_RING_SIZE, ringVAO);
+    glDeleteBuffers(STREAM_RING_SIZE, ringVBO);
+    object.cleanup();
+}
+
+void StreamedHypercube::setDimensions(int dimensions) {
+    dimensions = std::min(std::max(dimensions, STREAM_MIN_DIMENSIONS), STREAM_MAX_DIMENSIONS);
+    makeStreamPlanes(dimensions, planes);
+    identity.resize((size_t)dimensions * dimensions);
+    rotation.resize((size_t)dimensions * dimensions);
+
+    object.dimensions = dimensions;
+    object.defaultRotationPlanes = planes.data();
+    object.numRotationPlanes = (int)planes.size();
+    object.identityMatrix = identity.data();
+    object.scale = streamScale(dimensions);
+    object.initIdentityMatrix();
+}
+
+long long StreamedHypercube::edgeCount() const {
+    return (long long)object.dimensions << (object.dimensions - 1);
+}
+
+int StreamedHypercube::chunkCount() const {
+    long long vertices = 1LL << object.dimensions;
+    int perChunk = streamVerticesPerChunk(object.dimensions);
+    return (int)((vertices + perChunk - 1) / perChunk);
+}
+
+void StreamedHypercube::startWorkers() {
+    int threadCount = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+    slots.resize((size_t)threadCount * 2);
+    for (StagingSlot& slot : slots) {
+        slot.vertices.resize((size_t)STREAM_CHUNK_EDGES * 6);
+    }
+    stopping = false;
+    for (int i = 0; i < threadCount; i++) {
+        workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+void StreamedHypercube::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    slots.clear();
+}
+
+void StreamedHypercube::workerLoop() {
+    traceSetThreadName("Stream generator");
+    for (;;) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this]() { return stopping || nextChunk < frameChunks; });
+        if (stopping) {
+            return;
+        }
+        long long chunk = nextChunk++;
+        StagingSlot& slot = slots[chunk % slots.size()];
+        // the slot frees up once the draw thread has consumed chunk - slots.size()
+        changed.wait(lock, [this, &slot]() { return stopping || slot.chunk < 0; });
+        if (stopping) {
+            return;
+        }
+        slot.chunk = chunk;
+        slot.ready = false;
+        lock.unlock();
+
+        int perChunk = streamVerticesPerChunk(frame.dimensions);
+        long long first = chunk * perChunk;
+        int count = (int)std::min<long long>(perChunk, (1LL << frame.dimensions) - first);
+        int edges;
+        {
+            TraceScope trace("Generate chunk", "stream");
+            edges = generateHypercubeChunk(frame, first, count, slot.vertices.data());
+        }
+
+        lock.lock();
+        slot.edges = edges;
+        slot.ready = true;
+        lock.unlock();
+        changed.notify_all();
+    }
+}
+
+void StreamedHypercube::uploadAndDraw(const StagingSlot& slot) {
+    TraceScope trace("Upload chunk", "stream");
+    int ring = ringNext;
+    ringNext = (ringNext + 1) % STREAM_RING_SIZE;
+
+    // the buffer may still be read by the draw issued STREAM_RING_SIZE chunks ago
+    if (ringFence[ring] != nullptr) {
+        glClientWaitSync(ringFence[ring], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ULL);
+        glDeleteSync(ringFence[ring]);
+        ringFence[ring] = nullptr;
+    }
+
+    size_t bytes = (size_t)slot.edges * 6 * sizeof(float);
+    glBindBuffer(GL_ARRAY_BUFFER, ringVBO[ring]);
+    void* mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, bytes,
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (mapped == nullptr) {
+        return;
+    }
+    memcpy(mapped, slot.vertices.data(), bytes);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+
+    glBindVertexArray(ringVAO[ring]);
+    glDrawArrays(GL_LINES, 0, slot.edges * 2);
+    ringFence[ring] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void StreamedHypercube::draw(float sceneTime, const glm::mat4& view, const glm::mat4& projection, Shader* shader) {
+    object.buildRotationMatrix(rotation.data(), sceneTime);
+
+    float identity3D[9];
+    generateIdentityMatrix(identity3D, 3);
+    Shader& active = shader != nullptr ? *shader : *object.shader;
+    active.use();
+    active.setFloatArray("rotationMat", identity3D, 9);
+    active.setFloat("scale", 1.0f);
+    active.setFloat("positionScale", 1.0f);
+    active.setMat4("view", view);
+    active.setMat4("projection", projection);
+    glLineWidth(EDGE_THICKNESS);
+
+    long long chunks = chunkCount();
+    {
+        // workers are idle between frames, so the frame data can be replaced here
+        std::lock_guard<std::mutex> lock(mutex);
+        prepareStreamFrame(frame, object.dimensions, rotation.data(), object.scale);
+        nextChunk = 0;
+        frameChunks = chunks;
+    }
+    changed.notify_all();
+
+    // draw chunks in order as they complete
+    for (long long chunk = 0; chunk < chunks; chunk++) {
+        StagingSlot& slot = slots[chunk % slots.size()];
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&slot, chunk]() { return slot.chunk == chunk && slot.ready; });
+        lock.unlock();
+
+        uploadAndDraw(slot);
+
+        lock.lock();
+        slot.chunk = -1;
+        slot.ready = false;
+        lock.unlock();
+        changed.notify_all();
+    }
+
+    glBindVertexArray(0);
+}
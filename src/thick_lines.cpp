@@ -0,0 +1,80 @@
+#include "thick_lines.h"
+
+#include "trace.h"
+
+void ThickLines::init() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &edgeBuffer);
+    glGenBuffers(1, &vertexBuffer);
+    glGenTextures(1, &vertexTexture);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, edgeBuffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribIPointer(0, 2, GL_UNSIGNED_INT, 2 * sizeof(unsigned int), (void*)0);
+    glVertexAttribDivisor(0, 1);
+    glBindVertexArray(0);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void ThickLines::cleanup() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &edgeBuffer);
+    glDeleteBuffers(1, &vertexBuffer);
+    glDeleteTextures(1, &vertexTexture);
+    VAO = edgeBuffer = vertexBuffer = vertexTexture = 0;
+    object = nullptr;
+}
+
+void ThickLines::setObject(const NDimObjectData& source) {
+    if (&source == object && source.geometryGeneration == objectGeneration) {
+        return;
+    }
+    TraceScope trace("Thick line upload", "gl");
+    setGeometry(source.vertices, source.vertexCount, source.dimensions, source.edges, source.edgeCount);
+    object = &source;
+    objectGeneration = source.geometryGeneration;
+}
+
+void ThickLines::setGeometry(const float* vertices, int vertexCount, int dimensions, const unsigned int* edgeList, int edgeCount) {
+    object = nullptr;
+    dims = dimensions;
+    edges = edgeCount;
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, (size_t)vertexCount * dims * sizeof(float), vertices, GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, edgeBuffer);
+    glBufferData(GL_ARRAY_BUFFER, (size_t)edgeCount * 2 * sizeof(unsigned int), edgeList, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void ThickLines::draw(Shader& shader, bool blend) {
+    if (edges == 0) {
+        return;
+    }
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    shader.setInt("vertexTable", 0);
+    shader.setInt("dimensions", dims);
+    shader.setVec2("viewport", (float)viewport[2], (float)viewport[3]);
+    shader.setFloat("halfWidth", 0.5f * EDGE_THICKNESS);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glBindVertexArray(VAO);
+    if (blend) {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, edges);
+    if (blend) {
+        glDisable(GL_BLEND);
+    }
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
@@ -0,0 +1,174 @@
+#include "trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+// Fields are relaxed atomics so a dump racing with the owning thread is well defined;
+// on x86/ARM these compile to plain loads and stores.
+struct TraceRecord {
+    std::atomic<const char*> name;
+    std::atomic<const char*> category;
+    std::atomic<long long> startUs;
+    std::atomic<long long> durationUs;    // < 0 marks an instant event
+};
+
+// Single-producer ring owned by one thread
+struct TraceRing {
+    int threadId = 0;
+    std::atomic<const char*> threadName{ nullptr };
+    std::atomic<unsigned long long> written{ 0 };
+    TraceRecord records[TRACE_RING_CAPACITY];
+};
+
+// Rings are never freed, so events from threads that already exited can still be dumped.
+// The mutex is only taken when a thread records its first event and when dumping.
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+std::vector<std::unique_ptr<TraceRing>>& registry() {
+    static std::vector<std::unique_ptr<TraceRing>> rings;
+    return rings;
+}
+
+thread_local TraceRing* localRing = nullptr;
+
+TraceRing* threadRing() {
+    if (localRing == nullptr) {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        std::unique_ptr<TraceRing> ring(new TraceRing());
+        ring->threadId = (int)registry().size() + 1;
+        localRing = ring.get();
+        registry().push_back(std::move(ring));
+    }
+    return localRing;
+}
+
+void record(const char* name, const char* category, long long startUs, long long durationUs) {
+    TraceRing* ring = threadRing();
+    unsigned long long index = ring->written.load(std::memory_order_relaxed);
+    TraceRecord& slot = ring->records[index % TRACE_RING_CAPACITY];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.category.store(category, std::memory_order_relaxed);
+    slot.startUs.store(startUs, std::memory_order_relaxed);
+    slot.durationUs.store(durationUs, std::memory_order_relaxed);
+    ring->written.store(index + 1, std::memory_order_release);
+}
+
+void writeJsonString(FILE* file, const char* text) {
+    fputc('"', file);
+    for (const char* c = text != nullptr ? text : ""; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', file);
+        }
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+} // namespace
+
+long long traceTimestampUs() {
+    return traceTimestampUs(std::chrono::steady_clock::now());
+}
+
+long long traceTimestampUs(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - traceEpoch).count();
+}
+
+void traceComplete(const char* name, const char* category, long long startUs, long long durationUs) {
+    record(name, category, startUs, std::max(0LL, durationUs));
+}
+
+void traceInstant(const char* name, const char* category) {
+    record(name, category, traceTimestampUs(), -1);
+}
+
+void traceSetThreadName(const char* name) {
+    threadRing()->threadName.store(name, std::memory_order_relaxed);
+}
+
+bool writeChromeTrace(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        std::cout << "ERROR::TRACE::COULD_NOT_OPEN " << path << std::endl;
+        return false;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    size_t eventCount = 0;
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    for (const std::unique_ptr<TraceRing>& ring : registry()) {
+        const char* threadName = ring->threadName.load(std::memory_order_relaxed);
+        if (threadName != nullptr) {
+            fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",\n", ring->threadId);
+            writeJsonString(file, threadName);
+            fprintf(file, "}}");
+            first = false;
+        }
+
+        unsigned long long end = ring->written.load(std::memory_order_acquire);
+        unsigned long long begin = end > (unsigned long long)TRACE_RING_CAPACITY ? end - TRACE_RING_CAPACITY : 0;
+        for (unsigned long long i = begin; i < end; i++) {
+            const TraceRecord& slot = ring->records[i % TRACE_RING_CAPACITY];
+            const char* name = slot.name.load(std::memory_order_relaxed);
+            const char* category = slot.category.load(std::memory_order_relaxed);
+            long long startUs = slot.startUs.load(std::memory_order_relaxed);
+            long long durationUs = slot.durationUs.load(std::memory_order_relaxed);
+
+            // the owner may have lapped us while we were reading; drop anything it overwrote.
+            // The fence keeps the relaxed field loads above from moving past this reload, and
+            // slot i is already being rewritten once record i + capacity has been started.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            unsigned long long now = ring->written.load(std::memory_order_relaxed);
+            if (i + TRACE_RING_CAPACITY <= now) {
+                continue;
+            }
+
+            fprintf(file, "%s{\"name\":", first ? "" : ",\n");
+            writeJsonString(file, name);
+            fprintf(file, ",\"cat\":");
+            writeJsonString(file, category);
+            if (durationUs < 0) {
+                fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,\"tid\":%d}", startUs, ring->threadId);
+            }
+            else {
+                fprintf(file, ",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%d}", startUs, durationUs, ring->threadId);
+            }
+            first = false;
+            eventCount++;
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+    bool ok = ferror(file) == 0;
+    fclose(file);
+    std::cout << "Wrote " << eventCount << " trace events to " << path << std::endl;
+    return ok;
+}
+
+std::string parseTraceArgs(int& argc, char** argv) {
+    std::string path;
+    int out = 1;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--trace" && i + 1 < argc) {
+            path = argv[++i];
+        }
+        else {
+            argv[out++] = argv[i];
+        }
+    }
+    argc = out;
+    return path;
+}
@@ -1,6197 +0,0 @@
-#include "vertex_data.h"
-
-// 2-Cube (Hypercube) Wireframe Pairs
-// Dimension: 2
-// Total Vertices: 4
-// Total Edges: 4
-// Total Floats: 16
-float hypercubeVerts_2D[] = {
-    // Edge 1 (connects vertex 0 and 1)
-    -1.0000f, -1.0000f,
-    1.0000f, -1.0000f,
-
-    // Edge 2 (connects vertex 0 and 2)
-    -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f,
-
-    // Edge 3 (connects vertex 1 and 3)
-    1.0000f, -1.0000f,
-    1.0000f, 1.0000f,
-
-    // Edge 4 (connects vertex 2 and 3)
-    -1.0000f, 1.0000f,
-    1.0000f, 1.0000f,
-
-};
-const size_t hypercubeVerts_2D_size = sizeof(hypercubeVerts_2D);
-
-float hypercubeVerts_3D[] = {
-    // Edge 1 (connects vertex 0 and 1)
-    -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 2 (connects vertex 0 and 2)
-    -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 3 (connects vertex 0 and 4)
-    -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 4 (connects vertex 1 and 3)
-    1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 5 (connects vertex 1 and 5)
-    1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 6 (connects vertex 2 and 3)
-    -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 7 (connects vertex 2 and 6)
-    -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 8 (connects vertex 3 and 7)
-    1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 9 (connects vertex 4 and 5)
-    -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 10 (connects vertex 4 and 6)
-    -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 11 (connects vertex 5 and 7)
-    1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 12 (connects vertex 6 and 7)
-    -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f,
-
-};
-const size_t hypercubeVerts_3D_size = sizeof(hypercubeVerts_3D);
-
-float hypercubeVerts_4D[] = {
-    // Edge 1 (connects vertex 0 and 1)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 2 (connects vertex 0 and 2)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 3 (connects vertex 0 and 4)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 4 (connects vertex 0 and 8)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 5 (connects vertex 1 and 3)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 6 (connects vertex 1 and 5)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 7 (connects vertex 1 and 9)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 8 (connects vertex 2 and 3)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 9 (connects vertex 2 and 6)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 10 (connects vertex 2 and 10)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 11 (connects vertex 3 and 7)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 12 (connects vertex 3 and 11)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 13 (connects vertex 4 and 5)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 14 (connects vertex 4 and 6)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 15 (connects vertex 4 and 12)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 16 (connects vertex 5 and 7)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 17 (connects vertex 5 and 13)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 18 (connects vertex 6 and 7)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 19 (connects vertex 6 and 14)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 20 (connects vertex 7 and 15)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 21 (connects vertex 8 and 9)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 22 (connects vertex 8 and 10)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 23 (connects vertex 8 and 12)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 24 (connects vertex 9 and 11)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 25 (connects vertex 9 and 13)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 26 (connects vertex 10 and 11)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 27 (connects vertex 10 and 14)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 28 (connects vertex 11 and 15)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 29 (connects vertex 12 and 13)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 30 (connects vertex 12 and 14)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 31 (connects vertex 13 and 15)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 32 (connects vertex 14 and 15)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-};
-const size_t hypercubeVerts_4D_size = sizeof(hypercubeVerts_4D);
-
-// 5-Cube (Hypercube) Wireframe Pairs
-// Dimension: 5
-// Total Vertices: 32
-// Total Edges: 80
-// Total Floats: 800
-float hypercubeVerts_5D[] = {
-    // Edge 1 (connects vertex 0 and 1)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 2 (connects vertex 0 and 2)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 3 (connects vertex 0 and 4)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 4 (connects vertex 0 and 8)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 5 (connects vertex 0 and 16)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 6 (connects vertex 1 and 3)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 7 (connects vertex 1 and 5)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 8 (connects vertex 1 and 9)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 9 (connects vertex 1 and 17)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 10 (connects vertex 2 and 3)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 11 (connects vertex 2 and 6)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 12 (connects vertex 2 and 10)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 13 (connects vertex 2 and 18)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 14 (connects vertex 3 and 7)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 15 (connects vertex 3 and 11)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 16 (connects vertex 3 and 19)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 17 (connects vertex 4 and 5)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 18 (connects vertex 4 and 6)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 19 (connects vertex 4 and 12)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 20 (connects vertex 4 and 20)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 21 (connects vertex 5 and 7)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 22 (connects vertex 5 and 13)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 23 (connects vertex 5 and 21)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 24 (connects vertex 6 and 7)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 25 (connects vertex 6 and 14)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 26 (connects vertex 6 and 22)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 27 (connects vertex 7 and 15)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 28 (connects vertex 7 and 23)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 29 (connects vertex 8 and 9)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 30 (connects vertex 8 and 10)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 31 (connects vertex 8 and 12)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 32 (connects vertex 8 and 24)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 33 (connects vertex 9 and 11)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 34 (connects vertex 9 and 13)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 35 (connects vertex 9 and 25)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 36 (connects vertex 10 and 11)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 37 (connects vertex 10 and 14)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 38 (connects vertex 10 and 26)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 39 (connects vertex 11 and 15)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 40 (connects vertex 11 and 27)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 41 (connects vertex 12 and 13)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 42 (connects vertex 12 and 14)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 43 (connects vertex 12 and 28)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 44 (connects vertex 13 and 15)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 45 (connects vertex 13 and 29)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 46 (connects vertex 14 and 15)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 47 (connects vertex 14 and 30)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 48 (connects vertex 15 and 31)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 49 (connects vertex 16 and 17)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 50 (connects vertex 16 and 18)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 51 (connects vertex 16 and 20)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 52 (connects vertex 16 and 24)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 53 (connects vertex 17 and 19)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 54 (connects vertex 17 and 21)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 55 (connects vertex 17 and 25)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 56 (connects vertex 18 and 19)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 57 (connects vertex 18 and 22)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 58 (connects vertex 18 and 26)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 59 (connects vertex 19 and 23)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 60 (connects vertex 19 and 27)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 61 (connects vertex 20 and 21)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 62 (connects vertex 20 and 22)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 63 (connects vertex 20 and 28)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 64 (connects vertex 21 and 23)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 65 (connects vertex 21 and 29)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 66 (connects vertex 22 and 23)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 67 (connects vertex 22 and 30)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 68 (connects vertex 23 and 31)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 69 (connects vertex 24 and 25)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 70 (connects vertex 24 and 26)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 71 (connects vertex 24 and 28)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 72 (connects vertex 25 and 27)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 73 (connects vertex 25 and 29)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 74 (connects vertex 26 and 27)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 75 (connects vertex 26 and 30)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 76 (connects vertex 27 and 31)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 77 (connects vertex 28 and 29)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 78 (connects vertex 28 and 30)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 79 (connects vertex 29 and 31)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 80 (connects vertex 30 and 31)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-};
-const size_t hypercubeVerts_5D_size = sizeof(hypercubeVerts_5D);
-
-// 6-Cube (Hypercube) Wireframe Pairs
-// Dimension: 6
-// Total Vertices: 64
-// Total Edges: 192
-// Total Floats: 2304
-float hypercubeVerts_6D[] = {
-    // Edge 1 (connects vertex 0 and 1)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 2 (connects vertex 0 and 2)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 3 (connects vertex 0 and 4)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 4 (connects vertex 0 and 8)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 5 (connects vertex 0 and 16)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 6 (connects vertex 0 and 32)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 7 (connects vertex 1 and 3)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 8 (connects vertex 1 and 5)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 9 (connects vertex 1 and 9)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 10 (connects vertex 1 and 17)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 11 (connects vertex 1 and 33)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 12 (connects vertex 2 and 3)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 13 (connects vertex 2 and 6)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 14 (connects vertex 2 and 10)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 15 (connects vertex 2 and 18)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 16 (connects vertex 2 and 34)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 17 (connects vertex 3 and 7)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 18 (connects vertex 3 and 11)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 19 (connects vertex 3 and 19)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 20 (connects vertex 3 and 35)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 21 (connects vertex 4 and 5)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 22 (connects vertex 4 and 6)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 23 (connects vertex 4 and 12)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 24 (connects vertex 4 and 20)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 25 (connects vertex 4 and 36)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 26 (connects vertex 5 and 7)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 27 (connects vertex 5 and 13)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 28 (connects vertex 5 and 21)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 29 (connects vertex 5 and 37)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 30 (connects vertex 6 and 7)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 31 (connects vertex 6 and 14)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 32 (connects vertex 6 and 22)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 33 (connects vertex 6 and 38)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 34 (connects vertex 7 and 15)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 35 (connects vertex 7 and 23)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 36 (connects vertex 7 and 39)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 37 (connects vertex 8 and 9)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 38 (connects vertex 8 and 10)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 39 (connects vertex 8 and 12)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 40 (connects vertex 8 and 24)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 41 (connects vertex 8 and 40)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 42 (connects vertex 9 and 11)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 43 (connects vertex 9 and 13)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 44 (connects vertex 9 and 25)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 45 (connects vertex 9 and 41)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 46 (connects vertex 10 and 11)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 47 (connects vertex 10 and 14)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 48 (connects vertex 10 and 26)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 49 (connects vertex 10 and 42)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 50 (connects vertex 11 and 15)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 51 (connects vertex 11 and 27)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 52 (connects vertex 11 and 43)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 53 (connects vertex 12 and 13)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 54 (connects vertex 12 and 14)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 55 (connects vertex 12 and 28)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 56 (connects vertex 12 and 44)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 57 (connects vertex 13 and 15)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 58 (connects vertex 13 and 29)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 59 (connects vertex 13 and 45)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 60 (connects vertex 14 and 15)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 61 (connects vertex 14 and 30)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 62 (connects vertex 14 and 46)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 63 (connects vertex 15 and 31)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 64 (connects vertex 15 and 47)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 65 (connects vertex 16 and 17)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 66 (connects vertex 16 and 18)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 67 (connects vertex 16 and 20)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 68 (connects vertex 16 and 24)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 69 (connects vertex 16 and 48)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 70 (connects vertex 17 and 19)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 71 (connects vertex 17 and 21)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 72 (connects vertex 17 and 25)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 73 (connects vertex 17 and 49)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 74 (connects vertex 18 and 19)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 75 (connects vertex 18 and 22)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 76 (connects vertex 18 and 26)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 77 (connects vertex 18 and 50)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 78 (connects vertex 19 and 23)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 79 (connects vertex 19 and 27)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 80 (connects vertex 19 and 51)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 81 (connects vertex 20 and 21)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 82 (connects vertex 20 and 22)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 83 (connects vertex 20 and 28)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 84 (connects vertex 20 and 52)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 85 (connects vertex 21 and 23)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 86 (connects vertex 21 and 29)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 87 (connects vertex 21 and 53)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 88 (connects vertex 22 and 23)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 89 (connects vertex 22 and 30)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 90 (connects vertex 22 and 54)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 91 (connects vertex 23 and 31)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 92 (connects vertex 23 and 55)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 93 (connects vertex 24 and 25)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 94 (connects vertex 24 and 26)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 95 (connects vertex 24 and 28)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 96 (connects vertex 24 and 56)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 97 (connects vertex 25 and 27)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 98 (connects vertex 25 and 29)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 99 (connects vertex 25 and 57)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 100 (connects vertex 26 and 27)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 101 (connects vertex 26 and 30)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 102 (connects vertex 26 and 58)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 103 (connects vertex 27 and 31)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 104 (connects vertex 27 and 59)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 105 (connects vertex 28 and 29)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 106 (connects vertex 28 and 30)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 107 (connects vertex 28 and 60)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 108 (connects vertex 29 and 31)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 109 (connects vertex 29 and 61)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 110 (connects vertex 30 and 31)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 111 (connects vertex 30 and 62)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 112 (connects vertex 31 and 63)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 113 (connects vertex 32 and 33)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 114 (connects vertex 32 and 34)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 115 (connects vertex 32 and 36)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 116 (connects vertex 32 and 40)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 117 (connects vertex 32 and 48)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 118 (connects vertex 33 and 35)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 119 (connects vertex 33 and 37)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 120 (connects vertex 33 and 41)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 121 (connects vertex 33 and 49)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 122 (connects vertex 34 and 35)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 123 (connects vertex 34 and 38)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 124 (connects vertex 34 and 42)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 125 (connects vertex 34 and 50)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 126 (connects vertex 35 and 39)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 127 (connects vertex 35 and 43)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 128 (connects vertex 35 and 51)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 129 (connects vertex 36 and 37)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 130 (connects vertex 36 and 38)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 131 (connects vertex 36 and 44)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 132 (connects vertex 36 and 52)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 133 (connects vertex 37 and 39)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 134 (connects vertex 37 and 45)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 135 (connects vertex 37 and 53)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 136 (connects vertex 38 and 39)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 137 (connects vertex 38 and 46)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 138 (connects vertex 38 and 54)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 139 (connects vertex 39 and 47)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 140 (connects vertex 39 and 55)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 141 (connects vertex 40 and 41)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 142 (connects vertex 40 and 42)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 143 (connects vertex 40 and 44)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 144 (connects vertex 40 and 56)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 145 (connects vertex 41 and 43)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 146 (connects vertex 41 and 45)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 147 (connects vertex 41 and 57)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 148 (connects vertex 42 and 43)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 149 (connects vertex 42 and 46)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 150 (connects vertex 42 and 58)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 151 (connects vertex 43 and 47)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 152 (connects vertex 43 and 59)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 153 (connects vertex 44 and 45)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 154 (connects vertex 44 and 46)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 155 (connects vertex 44 and 60)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 156 (connects vertex 45 and 47)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 157 (connects vertex 45 and 61)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 158 (connects vertex 46 and 47)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 159 (connects vertex 46 and 62)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 160 (connects vertex 47 and 63)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 161 (connects vertex 48 and 49)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 162 (connects vertex 48 and 50)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 163 (connects vertex 48 and 52)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 164 (connects vertex 48 and 56)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 165 (connects vertex 49 and 51)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 166 (connects vertex 49 and 53)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 167 (connects vertex 49 and 57)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 168 (connects vertex 50 and 51)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 169 (connects vertex 50 and 54)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 170 (connects vertex 50 and 58)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 171 (connects vertex 51 and 55)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 172 (connects vertex 51 and 59)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 173 (connects vertex 52 and 53)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 174 (connects vertex 52 and 54)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 175 (connects vertex 52 and 60)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 176 (connects vertex 53 and 55)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 177 (connects vertex 53 and 61)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 178 (connects vertex 54 and 55)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 179 (connects vertex 54 and 62)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 180 (connects vertex 55 and 63)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 181 (connects vertex 56 and 57)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 182 (connects vertex 56 and 58)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 183 (connects vertex 56 and 60)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 184 (connects vertex 57 and 59)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 185 (connects vertex 57 and 61)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 186 (connects vertex 58 and 59)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 187 (connects vertex 58 and 62)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 188 (connects vertex 59 and 63)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 189 (connects vertex 60 and 61)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 190 (connects vertex 60 and 62)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 191 (connects vertex 61 and 63)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 192 (connects vertex 62 and 63)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-};
-const size_t hypercubeVerts_6D_size = sizeof(hypercubeVerts_6D);
-
-// 7-Cube (Hypercube) Wireframe Pairs
-// Dimension: 7
-// Total Vertices: 128
-// Total Edges: 448
-// Total Floats: 6272
-float hypercubeVerts_7D[] = {
-    // Edge 1 (connects vertex 0 and 1)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 2 (connects vertex 0 and 2)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 3 (connects vertex 0 and 4)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 4 (connects vertex 0 and 8)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 5 (connects vertex 0 and 16)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 6 (connects vertex 0 and 32)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 7 (connects vertex 0 and 64)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 8 (connects vertex 1 and 3)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 9 (connects vertex 1 and 5)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 10 (connects vertex 1 and 9)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 11 (connects vertex 1 and 17)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 12 (connects vertex 1 and 33)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 13 (connects vertex 1 and 65)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 14 (connects vertex 2 and 3)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 15 (connects vertex 2 and 6)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 16 (connects vertex 2 and 10)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 17 (connects vertex 2 and 18)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 18 (connects vertex 2 and 34)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 19 (connects vertex 2 and 66)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 20 (connects vertex 3 and 7)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 21 (connects vertex 3 and 11)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 22 (connects vertex 3 and 19)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 23 (connects vertex 3 and 35)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 24 (connects vertex 3 and 67)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 25 (connects vertex 4 and 5)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 26 (connects vertex 4 and 6)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 27 (connects vertex 4 and 12)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 28 (connects vertex 4 and 20)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 29 (connects vertex 4 and 36)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 30 (connects vertex 4 and 68)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 31 (connects vertex 5 and 7)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 32 (connects vertex 5 and 13)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 33 (connects vertex 5 and 21)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 34 (connects vertex 5 and 37)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 35 (connects vertex 5 and 69)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 36 (connects vertex 6 and 7)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 37 (connects vertex 6 and 14)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 38 (connects vertex 6 and 22)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 39 (connects vertex 6 and 38)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 40 (connects vertex 6 and 70)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 41 (connects vertex 7 and 15)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 42 (connects vertex 7 and 23)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 43 (connects vertex 7 and 39)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 44 (connects vertex 7 and 71)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 45 (connects vertex 8 and 9)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 46 (connects vertex 8 and 10)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 47 (connects vertex 8 and 12)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 48 (connects vertex 8 and 24)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 49 (connects vertex 8 and 40)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 50 (connects vertex 8 and 72)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 51 (connects vertex 9 and 11)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 52 (connects vertex 9 and 13)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 53 (connects vertex 9 and 25)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 54 (connects vertex 9 and 41)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 55 (connects vertex 9 and 73)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 56 (connects vertex 10 and 11)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 57 (connects vertex 10 and 14)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 58 (connects vertex 10 and 26)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 59 (connects vertex 10 and 42)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 60 (connects vertex 10 and 74)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 61 (connects vertex 11 and 15)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 62 (connects vertex 11 and 27)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 63 (connects vertex 11 and 43)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 64 (connects vertex 11 and 75)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 65 (connects vertex 12 and 13)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 66 (connects vertex 12 and 14)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 67 (connects vertex 12 and 28)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 68 (connects vertex 12 and 44)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 69 (connects vertex 12 and 76)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 70 (connects vertex 13 and 15)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 71 (connects vertex 13 and 29)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 72 (connects vertex 13 and 45)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 73 (connects vertex 13 and 77)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 74 (connects vertex 14 and 15)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 75 (connects vertex 14 and 30)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 76 (connects vertex 14 and 46)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 77 (connects vertex 14 and 78)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 78 (connects vertex 15 and 31)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 79 (connects vertex 15 and 47)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 80 (connects vertex 15 and 79)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 81 (connects vertex 16 and 17)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 82 (connects vertex 16 and 18)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 83 (connects vertex 16 and 20)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 84 (connects vertex 16 and 24)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 85 (connects vertex 16 and 48)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 86 (connects vertex 16 and 80)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 87 (connects vertex 17 and 19)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 88 (connects vertex 17 and 21)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 89 (connects vertex 17 and 25)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 90 (connects vertex 17 and 49)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 91 (connects vertex 17 and 81)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 92 (connects vertex 18 and 19)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 93 (connects vertex 18 and 22)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 94 (connects vertex 18 and 26)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 95 (connects vertex 18 and 50)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 96 (connects vertex 18 and 82)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 97 (connects vertex 19 and 23)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 98 (connects vertex 19 and 27)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 99 (connects vertex 19 and 51)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 100 (connects vertex 19 and 83)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 101 (connects vertex 20 and 21)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 102 (connects vertex 20 and 22)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 103 (connects vertex 20 and 28)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 104 (connects vertex 20 and 52)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 105 (connects vertex 20 and 84)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 106 (connects vertex 21 and 23)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 107 (connects vertex 21 and 29)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 108 (connects vertex 21 and 53)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 109 (connects vertex 21 and 85)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 110 (connects vertex 22 and 23)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 111 (connects vertex 22 and 30)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 112 (connects vertex 22 and 54)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 113 (connects vertex 22 and 86)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 114 (connects vertex 23 and 31)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 115 (connects vertex 23 and 55)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 116 (connects vertex 23 and 87)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 117 (connects vertex 24 and 25)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 118 (connects vertex 24 and 26)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 119 (connects vertex 24 and 28)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 120 (connects vertex 24 and 56)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 121 (connects vertex 24 and 88)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 122 (connects vertex 25 and 27)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 123 (connects vertex 25 and 29)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 124 (connects vertex 25 and 57)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 125 (connects vertex 25 and 89)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 126 (connects vertex 26 and 27)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 127 (connects vertex 26 and 30)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 128 (connects vertex 26 and 58)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 129 (connects vertex 26 and 90)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 130 (connects vertex 27 and 31)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 131 (connects vertex 27 and 59)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 132 (connects vertex 27 and 91)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 133 (connects vertex 28 and 29)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 134 (connects vertex 28 and 30)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 135 (connects vertex 28 and 60)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 136 (connects vertex 28 and 92)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 137 (connects vertex 29 and 31)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 138 (connects vertex 29 and 61)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 139 (connects vertex 29 and 93)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 140 (connects vertex 30 and 31)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-
-    // Edge 141 (connects vertex 30 and 62)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 142 (connects vertex 30 and 94)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 143 (connects vertex 31 and 63)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 144 (connects vertex 31 and 95)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 145 (connects vertex 32 and 33)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 146 (connects vertex 32 and 34)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 147 (connects vertex 32 and 36)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 148 (connects vertex 32 and 40)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 149 (connects vertex 32 and 48)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 150 (connects vertex 32 and 96)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 151 (connects vertex 33 and 35)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 152 (connects vertex 33 and 37)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 153 (connects vertex 33 and 41)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 154 (connects vertex 33 and 49)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 155 (connects vertex 33 and 97)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 156 (connects vertex 34 and 35)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 157 (connects vertex 34 and 38)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 158 (connects vertex 34 and 42)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 159 (connects vertex 34 and 50)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 160 (connects vertex 34 and 98)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 161 (connects vertex 35 and 39)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 162 (connects vertex 35 and 43)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 163 (connects vertex 35 and 51)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 164 (connects vertex 35 and 99)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 165 (connects vertex 36 and 37)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 166 (connects vertex 36 and 38)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 167 (connects vertex 36 and 44)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 168 (connects vertex 36 and 52)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 169 (connects vertex 36 and 100)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 170 (connects vertex 37 and 39)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 171 (connects vertex 37 and 45)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 172 (connects vertex 37 and 53)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 173 (connects vertex 37 and 101)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 174 (connects vertex 38 and 39)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 175 (connects vertex 38 and 46)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 176 (connects vertex 38 and 54)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 177 (connects vertex 38 and 102)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 178 (connects vertex 39 and 47)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 179 (connects vertex 39 and 55)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 180 (connects vertex 39 and 103)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 181 (connects vertex 40 and 41)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 182 (connects vertex 40 and 42)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 183 (connects vertex 40 and 44)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 184 (connects vertex 40 and 56)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 185 (connects vertex 40 and 104)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 186 (connects vertex 41 and 43)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 187 (connects vertex 41 and 45)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 188 (connects vertex 41 and 57)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 189 (connects vertex 41 and 105)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 190 (connects vertex 42 and 43)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 191 (connects vertex 42 and 46)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 192 (connects vertex 42 and 58)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 193 (connects vertex 42 and 106)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 194 (connects vertex 43 and 47)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 195 (connects vertex 43 and 59)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 196 (connects vertex 43 and 107)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 197 (connects vertex 44 and 45)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 198 (connects vertex 44 and 46)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 199 (connects vertex 44 and 60)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 200 (connects vertex 44 and 108)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 201 (connects vertex 45 and 47)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 202 (connects vertex 45 and 61)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 203 (connects vertex 45 and 109)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 204 (connects vertex 46 and 47)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 205 (connects vertex 46 and 62)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 206 (connects vertex 46 and 110)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 207 (connects vertex 47 and 63)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 208 (connects vertex 47 and 111)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 209 (connects vertex 48 and 49)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 210 (connects vertex 48 and 50)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 211 (connects vertex 48 and 52)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 212 (connects vertex 48 and 56)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 213 (connects vertex 48 and 112)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 214 (connects vertex 49 and 51)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 215 (connects vertex 49 and 53)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 216 (connects vertex 49 and 57)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 217 (connects vertex 49 and 113)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 218 (connects vertex 50 and 51)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 219 (connects vertex 50 and 54)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 220 (connects vertex 50 and 58)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 221 (connects vertex 50 and 114)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 222 (connects vertex 51 and 55)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 223 (connects vertex 51 and 59)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 224 (connects vertex 51 and 115)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 225 (connects vertex 52 and 53)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 226 (connects vertex 52 and 54)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 227 (connects vertex 52 and 60)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 228 (connects vertex 52 and 116)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 229 (connects vertex 53 and 55)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 230 (connects vertex 53 and 61)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 231 (connects vertex 53 and 117)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 232 (connects vertex 54 and 55)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 233 (connects vertex 54 and 62)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 234 (connects vertex 54 and 118)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 235 (connects vertex 55 and 63)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 236 (connects vertex 55 and 119)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 237 (connects vertex 56 and 57)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 238 (connects vertex 56 and 58)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 239 (connects vertex 56 and 60)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 240 (connects vertex 56 and 120)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 241 (connects vertex 57 and 59)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 242 (connects vertex 57 and 61)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 243 (connects vertex 57 and 121)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 244 (connects vertex 58 and 59)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 245 (connects vertex 58 and 62)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 246 (connects vertex 58 and 122)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 247 (connects vertex 59 and 63)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 248 (connects vertex 59 and 123)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 249 (connects vertex 60 and 61)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 250 (connects vertex 60 and 62)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 251 (connects vertex 60 and 124)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 252 (connects vertex 61 and 63)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 253 (connects vertex 61 and 125)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 254 (connects vertex 62 and 63)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-
-    // Edge 255 (connects vertex 62 and 126)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 256 (connects vertex 63 and 127)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 257 (connects vertex 64 and 65)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 258 (connects vertex 64 and 66)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 259 (connects vertex 64 and 68)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 260 (connects vertex 64 and 72)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 261 (connects vertex 64 and 80)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 262 (connects vertex 64 and 96)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 263 (connects vertex 65 and 67)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 264 (connects vertex 65 and 69)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 265 (connects vertex 65 and 73)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 266 (connects vertex 65 and 81)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 267 (connects vertex 65 and 97)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 268 (connects vertex 66 and 67)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 269 (connects vertex 66 and 70)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 270 (connects vertex 66 and 74)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 271 (connects vertex 66 and 82)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 272 (connects vertex 66 and 98)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 273 (connects vertex 67 and 71)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 274 (connects vertex 67 and 75)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 275 (connects vertex 67 and 83)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 276 (connects vertex 67 and 99)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 277 (connects vertex 68 and 69)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 278 (connects vertex 68 and 70)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 279 (connects vertex 68 and 76)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 280 (connects vertex 68 and 84)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 281 (connects vertex 68 and 100)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 282 (connects vertex 69 and 71)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 283 (connects vertex 69 and 77)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 284 (connects vertex 69 and 85)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 285 (connects vertex 69 and 101)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 286 (connects vertex 70 and 71)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 287 (connects vertex 70 and 78)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 288 (connects vertex 70 and 86)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 289 (connects vertex 70 and 102)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 290 (connects vertex 71 and 79)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 291 (connects vertex 71 and 87)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 292 (connects vertex 71 and 103)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 293 (connects vertex 72 and 73)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 294 (connects vertex 72 and 74)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 295 (connects vertex 72 and 76)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 296 (connects vertex 72 and 88)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 297 (connects vertex 72 and 104)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 298 (connects vertex 73 and 75)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 299 (connects vertex 73 and 77)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 300 (connects vertex 73 and 89)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 301 (connects vertex 73 and 105)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 302 (connects vertex 74 and 75)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 303 (connects vertex 74 and 78)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 304 (connects vertex 74 and 90)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 305 (connects vertex 74 and 106)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 306 (connects vertex 75 and 79)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 307 (connects vertex 75 and 91)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 308 (connects vertex 75 and 107)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 309 (connects vertex 76 and 77)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 310 (connects vertex 76 and 78)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 311 (connects vertex 76 and 92)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 312 (connects vertex 76 and 108)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 313 (connects vertex 77 and 79)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 314 (connects vertex 77 and 93)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 315 (connects vertex 77 and 109)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 316 (connects vertex 78 and 79)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 317 (connects vertex 78 and 94)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 318 (connects vertex 78 and 110)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 319 (connects vertex 79 and 95)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 320 (connects vertex 79 and 111)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 321 (connects vertex 80 and 81)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 322 (connects vertex 80 and 82)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 323 (connects vertex 80 and 84)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 324 (connects vertex 80 and 88)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 325 (connects vertex 80 and 112)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 326 (connects vertex 81 and 83)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 327 (connects vertex 81 and 85)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 328 (connects vertex 81 and 89)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 329 (connects vertex 81 and 113)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 330 (connects vertex 82 and 83)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 331 (connects vertex 82 and 86)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 332 (connects vertex 82 and 90)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 333 (connects vertex 82 and 114)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 334 (connects vertex 83 and 87)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 335 (connects vertex 83 and 91)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 336 (connects vertex 83 and 115)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 337 (connects vertex 84 and 85)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 338 (connects vertex 84 and 86)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 339 (connects vertex 84 and 92)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 340 (connects vertex 84 and 116)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 341 (connects vertex 85 and 87)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 342 (connects vertex 85 and 93)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 343 (connects vertex 85 and 117)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 344 (connects vertex 86 and 87)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 345 (connects vertex 86 and 94)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 346 (connects vertex 86 and 118)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 347 (connects vertex 87 and 95)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 348 (connects vertex 87 and 119)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 349 (connects vertex 88 and 89)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 350 (connects vertex 88 and 90)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 351 (connects vertex 88 and 92)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 352 (connects vertex 88 and 120)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 353 (connects vertex 89 and 91)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 354 (connects vertex 89 and 93)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 355 (connects vertex 89 and 121)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 356 (connects vertex 90 and 91)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 357 (connects vertex 90 and 94)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 358 (connects vertex 90 and 122)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 359 (connects vertex 91 and 95)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 360 (connects vertex 91 and 123)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 361 (connects vertex 92 and 93)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 362 (connects vertex 92 and 94)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 363 (connects vertex 92 and 124)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 364 (connects vertex 93 and 95)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 365 (connects vertex 93 and 125)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 366 (connects vertex 94 and 95)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-
-    // Edge 367 (connects vertex 94 and 126)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 368 (connects vertex 95 and 127)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 369 (connects vertex 96 and 97)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 370 (connects vertex 96 and 98)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 371 (connects vertex 96 and 100)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 372 (connects vertex 96 and 104)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 373 (connects vertex 96 and 112)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 374 (connects vertex 97 and 99)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 375 (connects vertex 97 and 101)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 376 (connects vertex 97 and 105)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 377 (connects vertex 97 and 113)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 378 (connects vertex 98 and 99)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 379 (connects vertex 98 and 102)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 380 (connects vertex 98 and 106)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 381 (connects vertex 98 and 114)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 382 (connects vertex 99 and 103)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 383 (connects vertex 99 and 107)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 384 (connects vertex 99 and 115)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 385 (connects vertex 100 and 101)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 386 (connects vertex 100 and 102)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 387 (connects vertex 100 and 108)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 388 (connects vertex 100 and 116)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 389 (connects vertex 101 and 103)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 390 (connects vertex 101 and 109)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 391 (connects vertex 101 and 117)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 392 (connects vertex 102 and 103)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 393 (connects vertex 102 and 110)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 394 (connects vertex 102 and 118)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 395 (connects vertex 103 and 111)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 396 (connects vertex 103 and 119)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 397 (connects vertex 104 and 105)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 398 (connects vertex 104 and 106)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 399 (connects vertex 104 and 108)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 400 (connects vertex 104 and 120)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 401 (connects vertex 105 and 107)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 402 (connects vertex 105 and 109)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 403 (connects vertex 105 and 121)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 404 (connects vertex 106 and 107)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 405 (connects vertex 106 and 110)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 406 (connects vertex 106 and 122)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 407 (connects vertex 107 and 111)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 408 (connects vertex 107 and 123)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 409 (connects vertex 108 and 109)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 410 (connects vertex 108 and 110)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 411 (connects vertex 108 and 124)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 412 (connects vertex 109 and 111)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 413 (connects vertex 109 and 125)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 414 (connects vertex 110 and 111)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 415 (connects vertex 110 and 126)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 416 (connects vertex 111 and 127)
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 417 (connects vertex 112 and 113)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 418 (connects vertex 112 and 114)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 419 (connects vertex 112 and 116)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 420 (connects vertex 112 and 120)
-    -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 421 (connects vertex 113 and 115)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 422 (connects vertex 113 and 117)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 423 (connects vertex 113 and 121)
-    1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 424 (connects vertex 114 and 115)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 425 (connects vertex 114 and 118)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 426 (connects vertex 114 and 122)
-    -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 427 (connects vertex 115 and 119)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 428 (connects vertex 115 and 123)
-    1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 429 (connects vertex 116 and 117)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 430 (connects vertex 116 and 118)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 431 (connects vertex 116 and 124)
-    -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 432 (connects vertex 117 and 119)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 433 (connects vertex 117 and 125)
-    1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 434 (connects vertex 118 and 119)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 435 (connects vertex 118 and 126)
-    -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 436 (connects vertex 119 and 127)
-    1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 437 (connects vertex 120 and 121)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 438 (connects vertex 120 and 122)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 439 (connects vertex 120 and 124)
-    -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 440 (connects vertex 121 and 123)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 441 (connects vertex 121 and 125)
-    1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 442 (connects vertex 122 and 123)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 443 (connects vertex 122 and 126)
-    -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 444 (connects vertex 123 and 127)
-    1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 445 (connects vertex 124 and 125)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 446 (connects vertex 124 and 126)
-    -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 447 (connects vertex 125 and 127)
-    1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-    // Edge 448 (connects vertex 126 and 127)
-    -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-    1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-
-};
-const size_t hypercubeVerts_7D_size = sizeof(hypercubeVerts_7D);
-
-// 8-Cube (Hypercube) Wireframe Pairs
-// Dimension: 8
-// Total Vertices: 256
-// Total Edges: 1024
-// Total Floats: 16384
-float hypercubeVerts_8D[] = {
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, -1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
--1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f, 1.0000f,
-};
-const size_t hypercubeVerts_8D_size = sizeof(hypercubeVerts_8D);
-
-// Regular 2-Simplex (Wireframe Pairs)
-// Dimension: 2
-// Total Vertices: 3
-// Total Edges: 3
-float simplexVerts_2D[] = {
-    -1.1547f, 0.0000f,
-    0.5774f, -1.0000f,
-    -1.1547f, 0.0000f,
-    0.5774f, 1.0000f,
-    0.5774f, -1.0000f,
-    0.5774f, 1.0000f,
-};
-const size_t simplexVerts_2D_size = sizeof(simplexVerts_2D);
-
-// Regular 3-Simplex (Wireframe Pairs)
-// Dimension: 3
-// Total Vertices: 4
-// Total Edges: 6
-float simplexVerts_3D[] = {
-    -0.0000f, -1.2247f, 0.0000f,
-    1.1547f, 0.4082f, -0.0000f,
-    -0.0000f, -1.2247f, 0.0000f,
-    -0.5774f, 0.4082f, -1.0000f,
-    -0.0000f, -1.2247f, 0.0000f,
-    -0.5774f, 0.4082f, 1.0000f,
-    1.1547f, 0.4082f, -0.0000f,
-    -0.5774f, 0.4082f, -1.0000f,
-    1.1547f, 0.4082f, -0.0000f,
-    -0.5774f, 0.4082f, 1.0000f,
-    -0.5774f, 0.4082f, -1.0000f,
-    -0.5774f, 0.4082f, 1.0000f,
-};
-const size_t simplexVerts_3D_size = sizeof(simplexVerts_3D);
-
-// Regular 4-Simplex (Wireframe Pairs)
-// Dimension: 4
-// Total Vertices: 5
-// Total Edges: 10
-float simplexVerts_4D[] = {
-    0.0000f, 0.0000f, -1.2649f, 0.0000f,
-    -0.1748f, 0.7635f, 0.3162f, -0.9415f,
-    0.0000f, 0.0000f, -1.2649f, 0.0000f,
-    -0.8174f, -0.9103f, 0.3162f, -0.0554f,
-    0.0000f, 0.0000f, -1.2649f, 0.0000f,
-    1.1321f, -0.4640f, 0.3162f, -0.0554f,
-    0.0000f, 0.0000f, -1.2649f, 0.0000f,
-    -0.1399f, 0.6108f, 0.3162f, 1.0523f,
-    -0.1748f, 0.7635f, 0.3162f, -0.9415f,
-    -0.8174f, -0.9103f, 0.3162f, -0.0554f,
-    -0.1748f, 0.7635f, 0.3162f, -0.9415f,
-    1.1321f, -0.4640f, 0.3162f, -0.0554f,
-    -0.1748f, 0.7635f, 0.3162f, -0.9415f,
-    -0.1399f, 0.6108f, 0.3162f, 1.0523f,
-    -0.8174f, -0.9103f, 0.3162f, -0.0554f,
-    1.1321f, -0.4640f, 0.3162f, -0.0554f,
-    -0.8174f, -0.9103f, 0.3162f, -0.0554f,
-    -0.1399f, 0.6108f, 0.3162f, 1.0523f,
-    1.1321f, -0.4640f, 0.3162f, -0.0554f,
-    -0.1399f, 0.6108f, 0.3162f, 1.0523f,
-};
-const size_t simplexVerts_4D_size = sizeof(simplexVerts_4D);
-
-// Regular 5-Simplex (Wireframe Pairs)
-// Dimension: 5
-// Total Vertices: 6
-// Total Edges: 15
-float simplexVerts_5D[] = {
-    -0.0000f, 0.0000f, -1.2910f, 0.0000f, -0.0000f,
-    0.1072f, 0.1461f, 0.2582f, 0.1063f, -1.2474f,
-    -0.0000f, 0.0000f, -1.2910f, 0.0000f, -0.0000f,
-    -0.3917f, 1.0731f, 0.2582f, -0.3884f, 0.3796f,
-    -0.0000f, 0.0000f, -1.2910f, 0.0000f, -0.0000f,
-    1.1679f, -0.1713f, 0.2582f, -0.2502f, 0.3796f,
-    -0.0000f, 0.0000f, -1.2910f, 0.0000f, -0.0000f,
-    -0.6429f, -0.8766f, 0.2582f, -0.6376f, 0.1085f,
-    -0.0000f, 0.0000f, -1.2910f, 0.0000f, -0.0000f,
-    -0.2404f, -0.1713f, 0.2582f, 1.1699f, 0.3796f,
-    0.1072f, 0.1461f, 0.2582f, 0.1063f, -1.2474f,
-    -0.3917f, 1.0731f, 0.2582f, -0.3884f, 0.3796f,
-    0.1072f, 0.1461f, 0.2582f, 0.1063f, -1.2474f,
-    1.1679f, -0.1713f, 0.2582f, -0.2502f, 0.3796f,
-    0.1072f, 0.1461f, 0.2582f, 0.1063f, -1.2474f,
-    -0.6429f, -0.8766f, 0.2582f, -0.6376f, 0.1085f,
-    0.1072f, 0.1461f, 0.2582f, 0.1063f, -1.2474f,
-    -0.2404f, -0.1713f, 0.2582f, 1.1699f, 0.3796f,
-    -0.3917f, 1.0731f, 0.2582f, -0.3884f, 0.3796f,
-    1.1679f, -0.1713f, 0.2582f, -0.2502f, 0.3796f,
-    -0.3917f, 1.0731f, 0.2582f, -0.3884f, 0.3796f,
-    -0.6429f, -0.8766f, 0.2582f, -0.6376f, 0.1085f,
-    -0.3917f, 1.0731f, 0.2582f, -0.3884f, 0.3796f,
-    -0.2404f, -0.1713f, 0.2582f, 1.1699f, 0.3796f,
-    1.1679f, -0.1713f, 0.2582f, -0.2502f, 0.3796f,
-    -0.6429f, -0.8766f, 0.2582f, -0.6376f, 0.1085f,
-    1.1679f, -0.1713f, 0.2582f, -0.2502f, 0.3796f,
-    -0.2404f, -0.1713f, 0.2582f, 1.1699f, 0.3796f,
-    -0.6429f, -0.8766f, 0.2582f, -0.6376f, 0.1085f,
-    -0.2404f, -0.1713f, 0.2582f, 1.1699f, 0.3796f,
-};
-const size_t simplexVerts_5D_size = sizeof(simplexVerts_5D);
-
-// Regular 6-Simplex (Wireframe Pairs)
-// Dimension: 6
-// Total Vertices: 7
-// Total Edges: 21
-float simplexVerts_6D[] = {
-    0.0000f, -1.3093f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -0.0662f, 0.2182f, 0.5998f, -0.7956f, 0.3120f, 0.7564f,
-    0.0000f, -1.3093f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.1509f, 0.2182f, 0.9374f, 0.3060f, -0.0817f, -0.8154f,
-    0.0000f, -1.3093f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.2823f, 0.2182f, -0.7191f, -0.7956f, -0.0584f, -0.6584f,
-    0.0000f, -1.3093f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.1995f, 0.2182f, -0.3021f, 0.3060f, 0.1965f, -0.0653f,
-    0.0000f, -1.3093f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.1842f, 0.2182f, -0.1584f, 0.3060f, -1.1292f, 0.4887f,
-    0.0000f, -1.3093f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.6483f, 0.2182f, -0.3577f, 0.6732f, 0.7608f, 0.2940f,
-    -0.0662f, 0.2182f, 0.5998f, -0.7956f, 0.3120f, 0.7564f,
-    0.1509f, 0.2182f, 0.9374f, 0.3060f, -0.0817f, -0.8154f,
-    -0.0662f, 0.2182f, 0.5998f, -0.7956f, 0.3120f, 0.7564f,
-    0.2823f, 0.2182f, -0.7191f, -0.7956f, -0.0584f, -0.6584f,
-    -0.0662f, 0.2182f, 0.5998f, -0.7956f, 0.3120f, 0.7564f,
-    -1.1995f, 0.2182f, -0.3021f, 0.3060f, 0.1965f, -0.0653f,
-    -0.0662f, 0.2182f, 0.5998f, -0.7956f, 0.3120f, 0.7564f,
-    0.1842f, 0.2182f, -0.1584f, 0.3060f, -1.1292f, 0.4887f,
-    -0.0662f, 0.2182f, 0.5998f, -0.7956f, 0.3120f, 0.7564f,
-    0.6483f, 0.2182f, -0.3577f, 0.6732f, 0.7608f, 0.2940f,
-    0.1509f, 0.2182f, 0.9374f, 0.3060f, -0.0817f, -0.8154f,
-    0.2823f, 0.2182f, -0.7191f, -0.7956f, -0.0584f, -0.6584f,
-    0.1509f, 0.2182f, 0.9374f, 0.3060f, -0.0817f, -0.8154f,
-    -1.1995f, 0.2182f, -0.3021f, 0.3060f, 0.1965f, -0.0653f,
-    0.1509f, 0.2182f, 0.9374f, 0.3060f, -0.0817f, -0.8154f,
-    0.1842f, 0.2182f, -0.1584f, 0.3060f, -1.1292f, 0.4887f,
-    0.1509f, 0.2182f, 0.9374f, 0.3060f, -0.0817f, -0.8154f,
-    0.6483f, 0.2182f, -0.3577f, 0.6732f, 0.7608f, 0.2940f,
-    0.2823f, 0.2182f, -0.7191f, -0.7956f, -0.0584f, -0.6584f,
-    -1.1995f, 0.2182f, -0.3021f, 0.3060f, 0.1965f, -0.0653f,
-    0.2823f, 0.2182f, -0.7191f, -0.7956f, -0.0584f, -0.6584f,
-    0.1842f, 0.2182f, -0.1584f, 0.3060f, -1.1292f, 0.4887f,
-    0.2823f, 0.2182f, -0.7191f, -0.7956f, -0.0584f, -0.6584f,
-    0.6483f, 0.2182f, -0.3577f, 0.6732f, 0.7608f, 0.2940f,
-    -1.1995f, 0.2182f, -0.3021f, 0.3060f, 0.1965f, -0.0653f,
-    0.1842f, 0.2182f, -0.1584f, 0.3060f, -1.1292f, 0.4887f,
-    -1.1995f, 0.2182f, -0.3021f, 0.3060f, 0.1965f, -0.0653f,
-    0.6483f, 0.2182f, -0.3577f, 0.6732f, 0.7608f, 0.2940f,
-    0.1842f, 0.2182f, -0.1584f, 0.3060f, -1.1292f, 0.4887f,
-    0.6483f, 0.2182f, -0.3577f, 0.6732f, 0.7608f, 0.2940f,
-};
-const size_t simplexVerts_6D_size = sizeof(simplexVerts_6D);
-
-// Regular 7-Simplex (Wireframe Pairs)
-// Dimension: 7
-// Total Vertices: 8
-// Total Edges: 28
-float simplexVerts_7D[] = {
-    -0.0000f, -0.0000f, 0.0000f, -1.3229f, 0.0000f, 0.0000f, -0.0000f,
-    -1.1321f, -0.4776f, 0.1556f, 0.1890f, -0.2707f, 0.3272f, 0.0009f,
-    -0.0000f, -0.0000f, 0.0000f, -1.3229f, 0.0000f, 0.0000f, -0.0000f,
-    0.3877f, -0.5986f, -0.4436f, 0.1890f, -0.6124f, -0.7024f, 0.3747f,
-    -0.0000f, -0.0000f, 0.0000f, -1.3229f, 0.0000f, 0.0000f, -0.0000f,
-    -0.2636f, 0.2119f, -0.6967f, 0.1890f, 0.8346f, -0.4531f, -0.4612f,
-    -0.0000f, -0.0000f, 0.0000f, -1.3229f, 0.0000f, 0.0000f, -0.0000f,
-    0.3877f, 0.1342f, 0.3963f, 0.1890f, -0.4692f, 0.0905f, -1.0773f,
-    -0.0000f, -0.0000f, 0.0000f, -1.3229f, 0.0000f, 0.0000f, -0.0000f,
-    0.2791f, 0.4768f, -0.6281f, 0.1890f, -0.2021f, 0.9191f, 0.3592f,
-    -0.0000f, -0.0000f, 0.0000f, -1.3229f, 0.0000f, 0.0000f, -0.0000f,
-    0.4963f, -0.6120f, 0.5754f, 0.1890f, 0.7692f, 0.3124f, 0.2705f,
-    -0.0000f, -0.0000f, 0.0000f, -1.3229f, 0.0000f, 0.0000f, -0.0000f,
-    -0.1551f, 0.8654f, 0.6411f, 0.1890f, -0.0494f, -0.4938f, 0.5330f,
-    -1.1321f, -0.4776f, 0.1556f, 0.1890f, -0.2707f, 0.3272f, 0.0009f,
-    0.3877f, -0.5986f, -0.4436f, 0.1890f, -0.6124f, -0.7024f, 0.3747f,
-    -1.1321f, -0.4776f, 0.1556f, 0.1890f, -0.2707f, 0.3272f, 0.0009f,
-    -0.2636f, 0.2119f, -0.6967f, 0.1890f, 0.8346f, -0.4531f, -0.4612f,
-    -1.1321f, -0.4776f, 0.1556f, 0.1890f, -0.2707f, 0.3272f, 0.0009f,
-    0.3877f, 0.1342f, 0.3963f, 0.1890f, -0.4692f, 0.0905f, -1.0773f,
-    -1.1321f, -0.4776f, 0.1556f, 0.1890f, -0.2707f, 0.3272f, 0.0009f,
-    0.2791f, 0.4768f, -0.6281f, 0.1890f, -0.2021f, 0.9191f, 0.3592f,
-    -1.1321f, -0.4776f, 0.1556f, 0.1890f, -0.2707f, 0.3272f, 0.0009f,
-    0.4963f, -0.6120f, 0.5754f, 0.1890f, 0.7692f, 0.3124f, 0.2705f,
-    -1.1321f, -0.4776f, 0.1556f, 0.1890f, -0.2707f, 0.3272f, 0.0009f,
-    -0.1551f, 0.8654f, 0.6411f, 0.1890f, -0.0494f, -0.4938f, 0.5330f,
-    0.3877f, -0.5986f, -0.4436f, 0.1890f, -0.6124f, -0.7024f, 0.3747f,
-    -0.2636f, 0.2119f, -0.6967f, 0.1890f, 0.8346f, -0.4531f, -0.4612f,
-    0.3877f, -0.5986f, -0.4436f, 0.1890f, -0.6124f, -0.7024f, 0.3747f,
-    0.3877f, 0.1342f, 0.3963f, 0.1890f, -0.4692f, 0.0905f, -1.0773f,
-    0.3877f, -0.5986f, -0.4436f, 0.1890f, -0.6124f, -0.7024f, 0.3747f,
-    0.2791f, 0.4768f, -0.6281f, 0.1890f, -0.2021f, 0.9191f, 0.3592f,
-    0.3877f, -0.5986f, -0.4436f, 0.1890f, -0.6124f, -0.7024f, 0.3747f,
-    0.4963f, -0.6120f, 0.5754f, 0.1890f, 0.7692f, 0.3124f, 0.2705f,
-    0.3877f, -0.5986f, -0.4436f, 0.1890f, -0.6124f, -0.7024f, 0.3747f,
-    -0.1551f, 0.8654f, 0.6411f, 0.1890f, -0.0494f, -0.4938f, 0.5330f,
-    -0.2636f, 0.2119f, -0.6967f, 0.1890f, 0.8346f, -0.4531f, -0.4612f,
-    0.3877f, 0.1342f, 0.3963f, 0.1890f, -0.4692f, 0.0905f, -1.0773f,
-    -0.2636f, 0.2119f, -0.6967f, 0.1890f, 0.8346f, -0.4531f, -0.4612f,
-    0.2791f, 0.4768f, -0.6281f, 0.1890f, -0.2021f, 0.9191f, 0.3592f,
-    -0.2636f, 0.2119f, -0.6967f, 0.1890f, 0.8346f, -0.4531f, -0.4612f,
-    0.4963f, -0.6120f, 0.5754f, 0.1890f, 0.7692f, 0.3124f, 0.2705f,
-    -0.2636f, 0.2119f, -0.6967f, 0.1890f, 0.8346f, -0.4531f, -0.4612f,
-    -0.1551f, 0.8654f, 0.6411f, 0.1890f, -0.0494f, -0.4938f, 0.5330f,
-    0.3877f, 0.1342f, 0.3963f, 0.1890f, -0.4692f, 0.0905f, -1.0773f,
-    0.2791f, 0.4768f, -0.6281f, 0.1890f, -0.2021f, 0.9191f, 0.3592f,
-    0.3877f, 0.1342f, 0.3963f, 0.1890f, -0.4692f, 0.0905f, -1.0773f,
-    0.4963f, -0.6120f, 0.5754f, 0.1890f, 0.7692f, 0.3124f, 0.2705f,
-    0.3877f, 0.1342f, 0.3963f, 0.1890f, -0.4692f, 0.0905f, -1.0773f,
-    -0.1551f, 0.8654f, 0.6411f, 0.1890f, -0.0494f, -0.4938f, 0.5330f,
-    0.2791f, 0.4768f, -0.6281f, 0.1890f, -0.2021f, 0.9191f, 0.3592f,
-    0.4963f, -0.6120f, 0.5754f, 0.1890f, 0.7692f, 0.3124f, 0.2705f,
-    0.2791f, 0.4768f, -0.6281f, 0.1890f, -0.2021f, 0.9191f, 0.3592f,
-    -0.1551f, 0.8654f, 0.6411f, 0.1890f, -0.0494f, -0.4938f, 0.5330f,
-    0.4963f, -0.6120f, 0.5754f, 0.1890f, 0.7692f, 0.3124f, 0.2705f,
-    -0.1551f, 0.8654f, 0.6411f, 0.1890f, -0.0494f, -0.4938f, 0.5330f,
-};
-const size_t simplexVerts_7D_size = sizeof(simplexVerts_7D);
-
-// Regular 8-Simplex (Wireframe Pairs)
-// Dimension: 8
-// Total Vertices: 9
-// Total Edges: 36
-float simplexVerts_8D[] = {
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    0.0000f, -0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.3333f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    -0.0020f, 0.9942f, -0.0008f, -0.0001f, -0.0025f, -0.8727f, -0.0010f, 0.1667f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    0.6661f, 0.2691f, 0.2621f, 0.0487f, 0.8396f, 0.5885f, 0.3338f, 0.1667f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    -0.5765f, -0.4474f, 0.8399f, -0.6296f, 0.1513f, -0.2232f, 0.2075f, 0.1667f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    -0.3339f, 0.2631f, 0.0228f, -0.0483f, -0.0966f, 0.5885f, -1.1003f, 0.1667f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    -0.1916f, -0.4474f, -1.0555f, -0.3162f, 0.4991f, -0.2232f, 0.0071f, 0.1667f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    -0.3339f, 0.2631f, -0.2855f, -0.0005f, -0.7450f, 0.5885f, 0.7657f, 0.1667f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-    -0.1916f, -0.4474f, 0.1640f, 1.1981f, 0.0306f, -0.2232f, 0.0071f, 0.1667f,
-    0.9631f, -0.4474f, 0.0530f, -0.2520f, -0.6765f, -0.2232f, -0.2199f, 0.1667f,
-};
-const size_t simplexVerts_8D_size = sizeof(simplexVerts_8D);
-
-// Regular 2-Cross-Polytope (Wireframe Pairs)
-// Dimension: 2
-// Total Vertices: 4
-// Total Edges: 4
-float crossPolytopeVerts_2D[] = {
-    1.0000f, 0.0000f,
-    0.0000f, 1.0000f,
-    1.0000f, 0.0000f,
-    0.0000f, -1.0000f,
-    -1.0000f, 0.0000f,
-    0.0000f, 1.0000f,
-    -1.0000f, 0.0000f,
-    0.0000f, -1.0000f
-};
-const size_t crossPolytopeVerts_2D_size = sizeof(crossPolytopeVerts_2D);
-
-// Stats: 4 vertices, 4 edges, 8 wireframe vertices
-// Regular 3-Cross-Polytope (Wireframe Pairs)
-// Dimension: 3
-// Total Vertices: 12
-// Total Edges: 12
-float crossPolytopeVerts_3D[] = {
-    1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f,
-    1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f,
-    -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f,
-    -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f,
-    0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f,
-    0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f
-};
-const size_t crossPolytopeVerts_3D_size = sizeof(crossPolytopeVerts_3D);
-
-// Regular 4-Cross-Polytope (Wireframe Pairs)
-// Dimension: 4
-// Total Vertices: 24
-// Total Edges: 24
-float crossPolytopeVerts_4D[] = {
-    1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f
-};
-const size_t crossPolytopeVerts_4D_size = sizeof(crossPolytopeVerts_4D);
-
-// Regular 5-Cross-Polytope (Wireframe Pairs)
-// Dimension: 5
-// Total Vertices: 40
-// Total Edges: 40
-float crossPolytopeVerts_5D[] = {
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f
-};
-const size_t crossPolytopeVerts_5D_size = sizeof(crossPolytopeVerts_5D);
-
-// Regular 6-Cross-Polytope (Wireframe Pairs)
-// Dimension: 6
-// Total Vertices: 60
-// Total Edges: 60
-float crossPolytopeVerts_6D[] = {
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f
-};
-const size_t crossPolytopeVerts_6D_size = sizeof(crossPolytopeVerts_6D);
-
-// Regular 7-Cross-Polytope (Wireframe Pairs)
-// Dimension: 7
-// Total Vertices: 84
-// Total Edges: 84
-float crossPolytopeVerts_7D[] = {
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f
-};
-const size_t crossPolytopeVerts_7D_size = sizeof(crossPolytopeVerts_7D);
-
-// Regular 8-Cross-Polytope (Wireframe Pairs)
-// Dimension: 8
-// Total Vertices: 112
-// Total Edges: 112
-float crossPolytopeVerts_8D[] = {
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 1.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f, 0.0000f,
-    0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, 0.0000f, -1.0000f
-};
-const size_t crossPolytopeVerts_8D_size = sizeof(crossPolytopeVerts_8D);
@@ -0,0 +1,150 @@
+#include "vertex_format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+const char* vertexFormatName(VertexFormat format) {
+    switch (format) {
+    case VERTEX_FORMAT_HALF: return "Half Float";
+    case VERTEX_FORMAT_SNORM16: return "Snorm16";
+    case VERTEX_FORMAT_SNORM8: return "Snorm8";
+    default: return "Float32";
+    }
+}
+
+int vertexFormatComponentBytes(VertexFormat format) {
+    switch (format) {
+    case VERTEX_FORMAT_HALF:
+    case VERTEX_FORMAT_SNORM16: return 2;
+    case VERTEX_FORMAT_SNORM8: return 1;
+    default: return 4;
+    }
+}
+
+GLenum vertexFormatGLType(VertexFormat format) {
+    switch (format) {
+    case VERTEX_FORMAT_HALF: return GL_HALF_FLOAT;
+    case VERTEX_FORMAT_SNORM16: return GL_SHORT;
+    case VERTEX_FORMAT_SNORM8: return GL_BYTE;
+    default: return GL_FLOAT;
+    }
+}
+
+GLboolean vertexFormatNormalized(VertexFormat format) {
+    return format == VERTEX_FORMAT_SNORM16 || format == VERTEX_FORMAT_SNORM8 ? GL_TRUE : GL_FALSE;
+}
+
+int vertexFormatStride(VertexFormat format, int dims) {
+    return (dims * vertexFormatComponentBytes(format) + 3) & ~3;
+}
+
+unsigned short floatToHalf(float value) {
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+    unsigned int sign = (bits >> 16) & 0x8000u;
+    int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    unsigned int mantissa = bits & 0x7FFFFFu;
+
+    if (((bits >> 23) & 0xFF) == 0xFF) {
+        return (unsigned short)(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u));   // inf / nan
+    }
+    if (exponent >= 31) {
+        return (unsigned short)(sign | 0x7C00u);                                      // overflow to inf
+    }
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return (unsigned short)sign;                                              // underflow to zero
+        }
+        // subnormal: shift in the implicit bit, round to nearest even
+        mantissa |= 0x800000u;
+        int shift = 14 - exponent;
+        unsigned int half = mantissa >> shift;
+        unsigned int remainder = mantissa & ((1u << shift) - 1);
+        unsigned int halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1))) {
+            half++;
+        }
+        return (unsigned short)(sign | half);
+    }
+
+    unsigned int half = sign | ((unsigned int)exponent << 10) | (mantissa >> 13);
+    unsigned int remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1))) {
+        half++;                                                                       // may carry into the exponent, which is correct
+    }
+    return (unsigned short)half;
+}
+
+float halfToFloat(unsigned short half) {
+    unsigned int sign = (unsigned int)(half & 0x8000u) << 16;
+    unsigned int exponent = (half >> 10) & 0x1F;
+    unsigned int mantissa = half & 0x3FFu;
+    unsigned int bits;
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;
+        }
+        else {
+            // renormalize a subnormal
+            int e = -1;
+            do {
+                e++;
+                mantissa <<= 1;
+            } while ((mantissa & 0x400u) == 0);
+            bits = sign | ((unsigned int)(127 - 15 - e) << 23) | ((mantissa & 0x3FFu) << 13);
+        }
+    }
+    else if (exponent == 0x1F) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    }
+    else {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float encodeVertices(VertexFormat format, const float* vertices, int count, int dims,
+                     std::vector<unsigned char>& out) {
+    int stride = vertexFormatStride(format, dims);
+    out.assign((size_t)count * stride, 0);
+
+    float positionScale = 1.0f;
+    if (vertexFormatNormalized(format)) {
+        float largest = 0.0f;
+        for (size_t i = 0; i < (size_t)count * dims; i++) {
+            largest = std::max(largest, std::fabs(vertices[i]));
+        }
+        positionScale = largest > 0.0f ? largest : 1.0f;
+    }
+
+    for (int v = 0; v < count; v++) {
+        const float* in = vertices + (size_t)v * dims;
+        unsigned char* vertex = out.data() + (size_t)v * stride;
+        for (int c = 0; c < dims; c++) {
+            switch (format) {
+            case VERTEX_FORMAT_HALF: {
+                unsigned short half = floatToHalf(in[c]);
+                memcpy(vertex + c * 2, &half, 2);
+                break;
+            }
+            case VERTEX_FORMAT_SNORM16: {
+                short value = (short)std::lround(std::max(-1.0f, std::min(1.0f, in[c] / positionScale)) * 32767.0f);
+                memcpy(vertex + c * 2, &value, 2);
+                break;
+            }
+            case VERTEX_FORMAT_SNORM8: {
+                signed char value = (signed char)std::lround(std::max(-1.0f, std::min(1.0f, in[c] / positionScale)) * 127.0f);
+                memcpy(vertex + c, &value, 1);
+                break;
+            }
+            default:
+                memcpy(vertex + c * 4, &in[c], 4);
+                break;
+            }
+        }
+    }
+    return positionScale;
+}
@@ -0,0 +1,68 @@
+#include "vertex_sprites.h"
+
+#include "trace.h"
+
+void VertexSprites::init() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &vertexBuffer);
+    glGenTextures(1, &vertexTexture);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, vertexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void VertexSprites::cleanup() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &vertexBuffer);
+    glDeleteTextures(1, &vertexTexture);
+    VAO = vertexBuffer = vertexTexture = 0;
+    object = nullptr;
+}
+
+void VertexSprites::setObject(const NDimObjectData& source) {
+    if (&source == object && source.geometryGeneration == objectGeneration) {
+        return;
+    }
+    TraceScope trace("Vertex sprite upload", "gl");
+    setGeometry(source.vertices, source.vertexCount, source.dimensions);
+    object = &source;
+    objectGeneration = source.geometryGeneration;
+}
+
+void VertexSprites::setGeometry(const float* vertices, int vertexCount, int dimensions) {
+    object = nullptr;
+    dims = dimensions;
+    count = vertexCount;
+    glBindBuffer(GL_TEXTURE_BUFFER, vertexBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, (size_t)vertexCount * dims * sizeof(float), vertices, GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void VertexSprites::draw(Shader& shader, bool blend) {
+    if (count == 0) {
+        return;
+    }
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    shader.setInt("vertexTable", 0);
+    shader.setInt("dimensions", dims);
+    shader.setVec2("viewport", (float)viewport[2], (float)viewport[3]);
+    shader.setFloat("halfWidth", 0.5f * VERTEX_SIZE);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, vertexTexture);
+    glBindVertexArray(VAO);
+    if (blend) {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+    if (blend) {
+        glDisable(GL_BLEND);
+    }
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
@@ -0,0 +1,263 @@
+#include "wythoff.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "parallel_for.h"
+#include "polytope_cache.h"
+#include "trace.h"
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+const double KEY_QUANTUM = 1 << 20;           // grid cells per unit; vertices sit on the unit sphere
+
+// Coordinates snapped to a grid, so points equal up to rounding error hash alike
+struct PointKey {
+    int32_t q[WYTHOFF_MAX_RANK];
+
+    bool operator==(const PointKey& other) const { return memcmp(q, other.q, sizeof(q)) == 0; }
+};
+
+struct PointKeyHash {
+    size_t operator()(const PointKey& key) const { return (size_t)fnv1a64(key.q, sizeof(key.q)); }
+};
+
+PointKey makeKey(const double* point, int rank) {
+    PointKey key;
+    memset(&key, 0, sizeof(key));
+    for (int i = 0; i < rank; i++) {
+        key.q[i] = (int32_t)std::lround(point[i] * KEY_QUANTUM);
+    }
+    return key;
+}
+
+void reflect(const double* point, const double* normal, int rank, double* out) {
+    double dot = 0.0;
+    for (int i = 0; i < rank; i++) {
+        dot += point[i] * normal[i];
+    }
+    for (int i = 0; i < rank; i++) {
+        out[i] = point[i] - 2.0 * dot * normal[i];
+    }
+}
+
+void setLinear(CoxeterDiagram& diagram, const std::vector<int>& labels) {
+    diagram.rank = (int)labels.size() + 1;
+    for (int i = 0; i + 1 < diagram.rank; i++) {
+        diagram.order[i][i + 1] = diagram.order[i + 1][i] = labels[i];
+    }
+}
+
+void join(CoxeterDiagram& diagram, int a, int b) {
+    diagram.order[a][b] = diagram.order[b][a] = 3;
+}
+
+} // namespace
+
+bool parseCoxeterDiagram(const std::string& spec, CoxeterDiagram& diagram) {
+    diagram = CoxeterDiagram();
+    for (int i = 0; i < WYTHOFF_MAX_RANK; i++) {
+        for (int j = 0; j < WYTHOFF_MAX_RANK; j++) {
+            diagram.order[i][j] = 2;
+        }
+    }
+
+    char family = spec.empty() ? '\0' : spec[0];
+    if (family >= 'A' && family <= 'Z') {
+        int n = atoi(spec.c_str() + 1);
+        bool valid = n >= 1 && n <= WYTHOFF_MAX_RANK;
+        if (valid && family == 'A') {
+            setLinear(diagram, std::vector<int>(n - 1, 3));
+        }
+        else if (valid && family == 'B' && n >= 2) {
+            std::vector<int> labels(n - 1, 3);
+            labels[0] = 4;
+            setLinear(diagram, labels);
+        }
+        else if (valid && family == 'D' && n >= 4) {
+            setLinear(diagram, std::vector<int>(n - 2, 3));
+            diagram.rank = n;
+            join(diagram, n - 3, n - 1);
+        }
+        else if (valid && family == 'E' && n >= 6 && n <= 8) {
+            setLinear(diagram, std::vector<int>(n - 2, 3));
+            diagram.rank = n;
+            join(diagram, n - 4, n - 1);
+        }
+        else if (spec == "F4") {
+            setLinear(diagram, { 3, 4, 3 });
+        }
+        else if (spec == "H3" || spec == "H4") {
+            std::vector<int> labels(n - 1, 3);
+            labels[0] = 5;
+            setLinear(diagram, labels);
+        }
+        else {
+            std::cout << "ERROR::WYTHOFF::UNKNOWN_DIAGRAM " << spec << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // linear diagram: branch labels separated by spaces or dashes
+    std::string labelsText = spec;
+    for (char& c : labelsText) {
+        if (c == '-') {
+            c = ' ';
+        }
+    }
+    std::istringstream stream(labelsText);
+    std::vector<int> labels;
+    int label;
+    while (stream >> label) {
+        labels.push_back(label);
+    }
+    if (!stream.eof() || labels.empty() || (int)labels.size() >= WYTHOFF_MAX_RANK) {
+        std::cout << "ERROR::WYTHOFF::BAD_DIAGRAM " << spec << std::endl;
+        return false;
+    }
+    for (int l : labels) {
+        if (l < 2) {
+            std::cout << "ERROR::WYTHOFF::BAD_DIAGRAM " << spec << std::endl;
+            return false;
+        }
+    }
+    setLinear(diagram, labels);
+    return true;
+}
+
+bool generateWythoff(const CoxeterDiagram& diagram, const std::string& rings, PolytopeMesh& mesh, int threadCount) {
+    TraceScope trace("Wythoff construction", "geometry");
+    const int rank = diagram.rank;
+    bool anyRing = false;
+    bool validRings = (int)rings.size() == rank;
+    for (size_t i = 0; validRings && i < rings.size(); i++) {
+        bool ringed = rings[i] == 'x' || rings[i] == '1';
+        validRings = ringed || rings[i] == 'o' || rings[i] == '0';
+        anyRing = anyRing || ringed;
+    }
+    if (rank < 1 || rank > WYTHOFF_MAX_RANK || !validRings || !anyRing) {
+        std::cout << "ERROR::WYTHOFF::BAD_RINGS " << rings << std::endl;
+        return false;
+    }
+
+    // Mirror normals: Cholesky factor of the Gram matrix G_ij = -cos(pi / m_ij), one unit
+    // normal per row. The group is finite exactly when G is positive definite.
+    double normals[WYTHOFF_MAX_RANK][WYTHOFF_MAX_RANK] = {};
+    for (int i = 0; i < rank; i++) {
+        for (int j = 0; j <= i; j++) {
+            double sum = i == j ? 1.0 : -std::cos(PI / diagram.order[i][j]);
+            for (int k = 0; k < j; k++) {
+                sum -= normals[i][k] * normals[j][k];
+            }
+            if (i == j) {
+                if (sum <= 1e-9) {
+                    std::cout << "ERROR::WYTHOFF::INFINITE_GROUP" << std::endl;
+                    return false;
+                }
+                normals[i][i] = std::sqrt(sum);
+            }
+            else {
+                normals[i][j] = sum / normals[j][j];
+            }
+        }
+    }
+
+    // Seed point: distance 1 from the ringed mirrors, on the others (forward substitution)
+    double seed[WYTHOFF_MAX_RANK] = {};
+    double radius = 0.0;
+    for (int i = 0; i < rank; i++) {
+        double b = rings[i] == 'x' || rings[i] == '1' ? 1.0 : 0.0;
+        for (int k = 0; k < i; k++) {
+            b -= normals[i][k] * seed[k];
+        }
+        seed[i] = b / normals[i][i];
+        radius += seed[i] * seed[i];
+    }
+    radius = std::sqrt(radius);
+    for (int i = 0; i < rank; i++) {
+        seed[i] /= radius;
+    }
+
+    // Vertex orbit, breadth first. mirrorImage[v * rank + j] is the vertex R_j v.
+    std::vector<double> points(seed, seed + rank);
+    std::vector<int> mirrorImage;
+    std::unordered_map<PointKey, int, PointKeyHash> ids;
+    ids[makeKey(seed, rank)] = 0;
+
+    std::vector<double> images;
+    std::vector<PointKey> imageKeys;
+    for (int begin = 0, end = 1; begin < end; begin = end, end = (int)points.size() / rank) {
+        int frontier = end - begin;
+        images.resize((size_t)frontier * rank * rank);
+        imageKeys.resize((size_t)frontier * rank);
+        parallelFor(frontier, threadCount, [&](int i, int) {
+            const double* point = &points[(size_t)(begin + i) * rank];
+            for (int j = 0; j < rank; j++) {
+                double* image = &images[((size_t)i * rank + j) * rank];
+                reflect(point, normals[j], rank, image);
+                imageKeys[(size_t)i * rank + j] = makeKey(image, rank);
+            }
+        });
+
+        mirrorImage.resize((size_t)end * rank);
+        for (int i = 0; i < frontier; i++) {
+            for (int j = 0; j < rank; j++) {
+                auto inserted = ids.insert(std::make_pair(imageKeys[(size_t)i * rank + j], (int)(points.size() / rank)));
+                if (inserted.second) {
+                    const double* image = &images[((size_t)i * rank + j) * rank];
+                    points.insert(points.end(), image, image + rank);
+                }
+                mirrorImage[(size_t)(begin + i) * rank + j] = inserted.first->second;
+            }
+        }
+        if ((int)(points.size() / rank) > WYTHOFF_MAX_VERTICES) {
+            std::cout << "ERROR::WYTHOFF::TOO_MANY_VERTICES" << std::endl;
+            return false;
+        }
+    }
+    // Edge orbit of the seed edges {p, R_i p}, i ringed, using the mirror table
+    std::vector<unsigned long long> edgeQueue;
+    std::unordered_set<unsigned long long> edgeSet;
+    auto addEdge = [&](unsigned int a, unsigned int b) {
+        unsigned long long key = a < b ? ((unsigned long long)a << 32) | b : ((unsigned long long)b << 32) | a;
+        if (edgeSet.insert(key).second) {
+            edgeQueue.push_back(key);
+        }
+    };
+    for (int i = 0; i < rank; i++) {
+        if (rings[i] == 'x' || rings[i] == '1') {
+            addEdge(0, mirrorImage[i]);
+        }
+    }
+    for (size_t e = 0; e < edgeQueue.size(); e++) {
+        unsigned int a = (unsigned int)(edgeQueue[e] >> 32);
+        unsigned int b = (unsigned int)(edgeQueue[e] & 0xFFFFFFFFu);
+        for (int j = 0; j < rank; j++) {
+            addEdge(mirrorImage[(size_t)a * rank + j], mirrorImage[(size_t)b * rank + j]);
+        }
+    }
+
+    mesh.dimensions = rank;
+    mesh.vertices.resize(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        mesh.vertices[i] = (float)points[i];
+    }
+    mesh.edges.clear();
+    mesh.edges.reserve(edgeQueue.size() * 2);
+    for (unsigned long long key : edgeQueue) {
+        mesh.edges.push_back((unsigned int)(key >> 32));
+        mesh.edges.push_back((unsigned int)(key & 0xFFFFFFFFu));
+    }
+    mesh.facetOffsets.clear();
+    mesh.facetVertices.clear();
+    mesh.lattice.clear();
+    return true;
+}
@@ -0,0 +1,297 @@
+#include "zonotope.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+#include "parallel_for.h"
+#include "trace.h"
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+
+// A generator vanishes on a flat when its component in the flat is below this fraction of its length
+const double VANISHING_TOLERANCE = 1e-6;
+
+typedef uint64_t SignMask;
+
+SignMask generatorBit(int j) { return (SignMask)1 << j; }
+
+// Sign vector of a region: bit j of plus (minus) is set when generator j is positive (negative)
+// on it. Generators vanishing on the region's flat are in neither.
+struct SignVector {
+    SignMask plus;
+    SignMask minus;
+
+    bool operator==(const SignVector& other) const { return plus == other.plus && minus == other.minus; }
+    bool operator<(const SignVector& other) const { return plus < other.plus || (plus == other.plus && minus < other.minus); }
+};
+
+// Flat of the arrangement: the subspace orthogonal to exactly the vanishing generators
+struct Flat {
+    SignMask vanishing = 0;
+    std::vector<double> basis;        // orthonormal, dims doubles per vector
+    std::vector<int> children;        // flats one dimension lower (next level), one per wall
+    std::vector<SignVector> walls;    // per child: the generators vanishing there but not here, by side
+    std::vector<SignVector> regions;
+};
+
+// Child flat as found from one parent, before deduplication across parents
+struct ChildFlat {
+    SignMask vanishing;
+    SignVector wall;
+    std::vector<double> basis;
+};
+
+struct Arrangement {
+    int dims = 0;
+    int count = 0;
+    std::vector<double> generators;   // non-zero generators, dims doubles each
+    std::vector<double> lengths;
+};
+
+double dot(const double* a, const double* b, int dims) {
+    double sum = 0.0;
+    for (int i = 0; i < dims; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+// One child per distinct hyperplane cutting the flat: the flat's intersection with it, and
+// every generator that vanishes there. A hyperplane through an earlier child gives that child again.
+void findChildren(const Arrangement& arrangement, const Flat& flat, std::vector<ChildFlat>& children) {
+    int dims = arrangement.dims;
+    int rank = (int)(flat.basis.size() / dims);
+    SignMask covered = flat.vanishing;
+    std::vector<double> normal(dims);
+    std::vector<std::pair<double, int>> alignment(rank);
+
+    for (int j = 0; j < arrangement.count; j++) {
+        if (covered & generatorBit(j)) {
+            continue;
+        }
+        // the generator's component in the flat is the wall's normal
+        const double* g = &arrangement.generators[(size_t)j * dims];
+        std::fill(normal.begin(), normal.end(), 0.0);
+        for (int b = 0; b < rank; b++) {
+            const double* axis = &flat.basis[(size_t)b * dims];
+            double c = dot(axis, g, dims);
+            for (int i = 0; i < dims; i++) {
+                normal[i] += c * axis[i];
+            }
+            alignment[b] = std::make_pair(std::fabs(c), b);
+        }
+        double length = std::sqrt(dot(normal.data(), normal.data(), dims));
+        for (int i = 0; i < dims; i++) {
+            normal[i] /= length;
+        }
+
+        // project the normal out of the flat's basis; the axis most aligned with it drops out
+        ChildFlat child;
+        std::sort(alignment.begin(), alignment.end());
+        for (int a = 0; a + 1 < rank; a++) {
+            const double* axis = &flat.basis[(size_t)alignment[a].second * dims];
+            std::vector<double> v(axis, axis + dims);
+            double c = dot(v.data(), normal.data(), dims);
+            for (int i = 0; i < dims; i++) {
+                v[i] -= c * normal[i];
+            }
+            for (size_t offset = 0; offset < child.basis.size(); offset += dims) {
+                double d = dot(v.data(), &child.basis[offset], dims);
+                for (int i = 0; i < dims; i++) {
+                    v[i] -= d * child.basis[offset + i];
+                }
+            }
+            double norm = std::sqrt(dot(v.data(), v.data(), dims));
+            for (int i = 0; i < dims; i++) {
+                child.basis.push_back(v[i] / norm);
+            }
+        }
+
+        child.vanishing = flat.vanishing;
+        child.wall.plus = 0;
+        child.wall.minus = 0;
+        for (int l = 0; l < arrangement.count; l++) {
+            if (flat.vanishing & generatorBit(l)) {
+                continue;
+            }
+            const double* gl = &arrangement.generators[(size_t)l * dims];
+            double inChild = 0.0;
+            for (size_t offset = 0; offset < child.basis.size(); offset += dims) {
+                double c = dot(gl, &child.basis[offset], dims);
+                inChild += c * c;
+            }
+            double limit = VANISHING_TOLERANCE * arrangement.lengths[l];
+            if (l != j && inChild > limit * limit) {
+                continue;
+            }
+            child.vanishing |= generatorBit(l);
+            if (l == j || dot(gl, normal.data(), dims) > 0.0) {
+                child.wall.plus |= generatorBit(l);
+            }
+            else {
+                child.wall.minus |= generatorBit(l);
+            }
+        }
+        covered |= child.vanishing;
+        children.push_back(std::move(child));
+    }
+}
+
+// Regions of a flat: the two sides of every region of every child, deduplicated by sorting.
+// A flat no hyperplane cuts is a single region. With edges, also records each such pair as an edge.
+void collectRegions(Flat& flat, const std::vector<Flat>& below, std::vector<unsigned int>* edges) {
+    if (flat.children.empty()) {
+        SignVector whole = { 0, 0 };
+        flat.regions.push_back(whole);
+        return;
+    }
+    size_t sideCount = 0;
+    for (int child : flat.children) {
+        sideCount += 2 * below[child].regions.size();
+    }
+    std::vector<SignVector> sides;
+    sides.reserve(sideCount);
+    for (size_t c = 0; c < flat.children.size(); c++) {
+        const SignVector& wall = flat.walls[c];
+        for (const SignVector& r : below[flat.children[c]].regions) {
+            SignVector a = { r.plus | wall.plus, r.minus | wall.minus };
+            SignVector b = { r.plus | wall.minus, r.minus | wall.plus };
+            sides.push_back(a);
+            sides.push_back(b);
+        }
+    }
+    if (edges == nullptr) {
+        std::sort(sides.begin(), sides.end());
+        sides.erase(std::unique(sides.begin(), sides.end()), sides.end());
+        flat.regions.swap(sides);
+        return;
+    }
+
+    // edges need each side's region index, so sort an index array instead
+    std::vector<unsigned int> order(sides.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = (unsigned int)i;
+    }
+    std::sort(order.begin(), order.end(), [&sides](unsigned int a, unsigned int b) {
+        return sides[a] < sides[b] || (sides[a] == sides[b] && a < b);
+    });
+    std::vector<unsigned int> region(sides.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        if (i == 0 || !(sides[order[i]] == sides[order[i - 1]])) {
+            flat.regions.push_back(sides[order[i]]);
+        }
+        region[order[i]] = (unsigned int)flat.regions.size() - 1;
+    }
+    edges->assign(region.begin(), region.end());
+}
+
+} // namespace
+
+void generateCyclicGenerators(int count, int dims, std::vector<float>& generators) {
+    generators.resize((size_t)count * dims);
+    for (int g = 0; g < count; g++) {
+        double t = PI * g / count;
+        for (int i = 0; i < dims; i++) {
+            double angle = (i / 2 + 1) * t;
+            generators[(size_t)g * dims + i] = (float)(i % 2 == 0 ? std::cos(angle) : std::sin(angle));
+        }
+    }
+}
+
+bool generateZonotope(const float* generators, int generatorCount, int dims, PolytopeMesh& mesh, int threadCount) {
+    TraceScope trace("Zonotope", "geometry");
+    mesh = PolytopeMesh();
+    mesh.dimensions = dims;
+
+    Arrangement arrangement;
+    arrangement.dims = dims;
+    for (int g = 0; g < generatorCount; g++) {
+        const float* v = generators + (size_t)g * dims;
+        double length = 0.0;
+        for (int i = 0; i < dims; i++) {
+            length += (double)v[i] * v[i];
+        }
+        if (length > 0.0) {
+            arrangement.generators.insert(arrangement.generators.end(), v, v + dims);
+            arrangement.lengths.push_back(std::sqrt(length));
+        }
+    }
+    arrangement.count = (int)arrangement.lengths.size();
+    if (arrangement.count == 0) {
+        std::cout << "ERROR::ZONOTOPE::NO_GENERATORS" << std::endl;
+        return false;
+    }
+    if (arrangement.count > ZONOTOPE_MAX_GENERATORS) {
+        std::cout << "ERROR::ZONOTOPE::TOO_MANY_GENERATORS " << arrangement.count << std::endl;
+        return false;
+    }
+
+    // flats from the whole space down, one level per dimension, deduplicated by vanishing set
+    std::vector<std::vector<Flat>> levels(1, std::vector<Flat>(1));
+    for (int i = 0; i < dims; i++) {
+        for (int j = 0; j < dims; j++) {
+            levels[0][0].basis.push_back(i == j ? 1.0 : 0.0);
+        }
+    }
+    while (true) {
+        std::vector<Flat>& level = levels.back();
+        std::vector<std::vector<ChildFlat>> found(level.size());
+        parallelFor((int)level.size(), threadCount, [&arrangement, &level, &found](int f, int) {
+            findChildren(arrangement, level[f], found[f]);
+        });
+
+        std::vector<Flat> next;
+        std::unordered_map<SignMask, int> index;
+        for (size_t f = 0; f < level.size(); f++) {
+            for (ChildFlat& child : found[f]) {
+                auto inserted = index.emplace(child.vanishing, (int)next.size());
+                if (inserted.second) {
+                    next.push_back(Flat());
+                    next.back().vanishing = child.vanishing;
+                    next.back().basis.swap(child.basis);
+                }
+                level[f].children.push_back(inserted.first->second);
+                level[f].walls.push_back(child.wall);
+            }
+        }
+        if (next.empty()) {
+            break;
+        }
+        levels.push_back(std::move(next));
+    }
+
+    // regions from the bottom up; a level's regions are dropped once its parents have theirs
+    std::vector<Flat> none;
+    for (int l = (int)levels.size() - 1; l > 0; l--) {
+        const std::vector<Flat>& below = l + 1 < (int)levels.size() ? levels[l + 1] : none;
+        std::vector<Flat>& level = levels[l];
+        parallelFor((int)level.size(), threadCount, [&level, &below](int f, int) {
+            collectRegions(level[f], below, nullptr);
+        });
+        if (l + 1 < (int)levels.size()) {
+            std::vector<Flat>().swap(levels[l + 1]);
+        }
+    }
+    Flat& space = levels[0][0];
+    collectRegions(space, levels.size() > 1 ? levels[1] : none, &mesh.edges);
+
+    // regions of the whole space are the vertices: the generators summed with their signs
+    mesh.vertices.resize(space.regions.size() * dims);
+    for (size_t v = 0; v < space.regions.size(); v++) {
+        const SignVector& s = space.regions[v];
+        for (int i = 0; i < dims; i++) {
+            double sum = 0.0;
+            for (int g = 0; g < arrangement.count; g++) {
+                double sign = (s.plus & generatorBit(g)) ? 1.0 : (s.minus & generatorBit(g)) ? -1.0 : 0.0;
+                sum += sign * arrangement.generators[(size_t)g * dims + i];
+            }
+            mesh.vertices[v * dims + i] = (float)sum;
+        }
+    }
+    return true;
+}